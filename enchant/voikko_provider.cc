@@ -33,6 +33,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+#include <pthread.h>
 
 #include <glib.h>
 #include <libvoikko/voikko.h>
@@ -47,20 +49,562 @@
  */
 ENCHANT_PLUGIN_DECLARE("Voikko")
 
+/* The most libvoikko handles to have at a time */
+#define VOIKKO_MAX_HANDLES 16
+
+/**
+ * A pool of libvoikko handles, shared by all the dictionaries of the
+ * provider. A libvoikko handle may be used by only one thread at a time,
+ * so each call checks a handle out of the pool and returns it afterwards.
+ * Handles are initialized as the callers need them, up to one per
+ * processor; after that, callers wait for a handle to be returned. If
+ * libvoikko refuses to initialize another handle, the pool stays at the
+ * handles it has.
+ *
+ * The handles are terminated when the last dictionary is disposed.
+ */
+typedef struct {
+	pthread_mutex_t lock;
+	pthread_cond_t returned;
+
+	/* The initialized handles */
+	int handles[VOIKKO_MAX_HANDLES];
+	int n_handles;
+
+	/* The handles not checked out */
+	int free_handles[VOIKKO_MAX_HANDLES];
+	int n_free;
+
+	/* The handles initialized or being initialized */
+	int n_reserved;
+
+	/* The most handles to initialize */
+	int max_handles;
+
+	/* The dictionaries using the pool */
+	int n_dicts;
+} VoikkoPool;
+
+static VoikkoPool *
+voikko_pool_new (void)
+{
+	VoikkoPool *pool;
+	long n_cpus;
+
+	pool = g_new0 (VoikkoPool, 1);
+	pthread_mutex_init (&pool->lock, NULL);
+	pthread_cond_init (&pool->returned, NULL);
+
+	n_cpus = sysconf (_SC_NPROCESSORS_ONLN);
+	if (n_cpus < 1)
+		n_cpus = 1;
+	if (n_cpus > VOIKKO_MAX_HANDLES)
+		n_cpus = VOIKKO_MAX_HANDLES;
+	pool->max_handles = n_cpus;
+
+	return pool;
+}
+
+/* Terminate the handles. None may be checked out. */
+static void
+voikko_pool_clear (VoikkoPool * pool)
+{
+	int i;
+
+	for (i = 0; i < pool->n_handles; i++)
+		voikko_terminate (pool->handles[i]);
+	pool->n_handles = 0;
+	pool->n_free = 0;
+	pool->n_reserved = 0;
+}
+
+static void
+voikko_pool_free (VoikkoPool * pool)
+{
+	voikko_pool_clear (pool);
+	pthread_cond_destroy (&pool->returned);
+	pthread_mutex_destroy (&pool->lock);
+	g_free (pool);
+}
+
+/**
+ * Check out a handle, initializing a new one if all are in use and there
+ * may be more. The initialization is done without holding the lock, as it
+ * takes long. Returns the error of libvoikko if there are no handles and
+ * none can be initialized, and NULL otherwise.
+ */
+static const char *
+voikko_pool_checkout (VoikkoPool * pool, int * handle)
+{
+	const char *voikko_error;
+
+	pthread_mutex_lock (&pool->lock);
+	while (pool->n_free == 0) {
+		if (pool->n_reserved < pool->max_handles) {
+			pool->n_reserved++;
+			pthread_mutex_unlock (&pool->lock);
+
+			voikko_error = voikko_init (handle, "fi_FI", 0);
+
+			pthread_mutex_lock (&pool->lock);
+			if (voikko_error == NULL) {
+				pool->handles[pool->n_handles++] = *handle;
+				pthread_mutex_unlock (&pool->lock);
+				return NULL;
+			}
+
+			/* Do with the handles there are */
+			pool->n_reserved--;
+			pool->max_handles = pool->n_reserved;
+			if (pool->n_reserved == 0) {
+				pool->max_handles = 1;
+				pthread_mutex_unlock (&pool->lock);
+				return voikko_error;
+			}
+			continue;
+		}
+		pthread_cond_wait (&pool->returned, &pool->lock);
+	}
+	*handle = pool->free_handles[--pool->n_free];
+	pthread_mutex_unlock (&pool->lock);
+	return NULL;
+}
+
+static void
+voikko_pool_checkin (VoikkoPool * pool, int handle)
+{
+	pthread_mutex_lock (&pool->lock);
+	pool->free_handles[pool->n_free++] = handle;
+	pthread_cond_signal (&pool->returned);
+	pthread_mutex_unlock (&pool->lock);
+}
+
+/* The number of shards of the verdict cache, and the most words in each */
+#define VOIKKO_VERDICT_SHARDS 16
+#define VOIKKO_VERDICTS_PER_SHARD 4096
+
+/* The most words to keep the suggestions of */
+#define VOIKKO_SUGGESTION_CACHE_SIZE 256
+
+/**
+ * A part of the verdict cache, with a lock of its own, so that threads
+ * checking different words seldom wait for each other. A full shard is
+ * emptied.
+ */
+typedef struct {
+	pthread_mutex_t lock;
+
+	/* Map from a word to its verdict plus one */
+	GHashTable *verdicts;
+} VoikkoVerdictShard;
+
+/* The suggestions for a word, in the suggestion cache */
+typedef struct {
+	char *word;
+	char **suggestions;
+} VoikkoSuggestions;
+
+/**
+ * The data of the provider: the handle pool, and caches of the verdicts
+ * and suggestions of libvoikko. GUI editors check the same visible words
+ * again on every redraw, and libvoikko does a full morphological analysis
+ * each time. The words accepted by the user are answered from the lexicon
+ * of each dictionary before the caches.
+ */
+typedef struct {
+	VoikkoPool *pool;
+
+	VoikkoVerdictShard shards[VOIKKO_VERDICT_SHARDS];
+
+	/* The suggestions, the most recently used first */
+	pthread_mutex_t suggestion_lock;
+	GQueue *suggestion_lru;
+
+	/* Map from a word to its link in suggestion_lru */
+	GHashTable *suggestion_index;
+
+	/* Is the dictionary available: 1 or 0, or -1 if not known yet */
+	pthread_mutex_t probe_lock;
+	int available;
+} VoikkoData;
+
+static void
+voikko_suggestions_free (VoikkoSuggestions * entry)
+{
+	g_free (entry->word);
+	g_strfreev (entry->suggestions);
+	g_free (entry);
+}
+
+static VoikkoData *
+voikko_data_new (void)
+{
+	VoikkoData *data;
+	int i;
+
+	data = g_new0 (VoikkoData, 1);
+	data->pool = voikko_pool_new ();
+
+	for (i = 0; i < VOIKKO_VERDICT_SHARDS; i++) {
+		pthread_mutex_init (&data->shards[i].lock, NULL);
+		data->shards[i].verdicts = g_hash_table_new_full (
+			g_str_hash, g_str_equal, g_free, NULL);
+	}
+
+	pthread_mutex_init (&data->suggestion_lock, NULL);
+	data->suggestion_lru = g_queue_new ();
+	data->suggestion_index = g_hash_table_new_full (
+		g_str_hash, g_str_equal, NULL, NULL);
+
+	pthread_mutex_init (&data->probe_lock, NULL);
+	data->available = -1;
+
+	return data;
+}
+
+/* Empty the caches */
+static void
+voikko_data_clear_caches (VoikkoData * data)
+{
+	GList *link;
+	int i;
+
+	for (i = 0; i < VOIKKO_VERDICT_SHARDS; i++) {
+		pthread_mutex_lock (&data->shards[i].lock);
+		g_hash_table_remove_all (data->shards[i].verdicts);
+		pthread_mutex_unlock (&data->shards[i].lock);
+	}
+
+	pthread_mutex_lock (&data->suggestion_lock);
+	g_hash_table_remove_all (data->suggestion_index);
+	while ((link = g_queue_pop_head_link (data->suggestion_lru)) != NULL) {
+		voikko_suggestions_free ((VoikkoSuggestions *) link->data);
+		g_list_free_1 (link);
+	}
+	pthread_mutex_unlock (&data->suggestion_lock);
+}
+
+static void
+voikko_data_free (VoikkoData * data)
+{
+	int i;
+
+	voikko_data_clear_caches (data);
+
+	for (i = 0; i < VOIKKO_VERDICT_SHARDS; i++) {
+		g_hash_table_destroy (data->shards[i].verdicts);
+		pthread_mutex_destroy (&data->shards[i].lock);
+	}
+
+	g_hash_table_destroy (data->suggestion_index);
+	g_queue_free (data->suggestion_lru);
+	pthread_mutex_destroy (&data->suggestion_lock);
+	pthread_mutex_destroy (&data->probe_lock);
+
+	voikko_pool_free (data->pool);
+	g_free (data);
+}
+
+/**
+ * Find out whether the dictionary is available, by initializing a handle.
+ * This is done once per process, as enchant asks at every broker startup
+ * and language enumeration. The handle is left in the pool, warm for the
+ * first dictionary requested.
+ */
+static int
+voikko_data_probe (VoikkoData * data)
+{
+	int voikko_handle;
+	int available;
+
+	pthread_mutex_lock (&data->probe_lock);
+	if (data->available < 0) {
+		data->available = (voikko_pool_checkout (data->pool,
+							 &voikko_handle) == NULL);
+		if (data->available)
+			voikko_pool_checkin (data->pool, voikko_handle);
+	}
+	available = data->available;
+	pthread_mutex_unlock (&data->probe_lock);
+
+	return available;
+}
+
+static VoikkoVerdictShard *
+voikko_data_shard (VoikkoData * data, const char * word)
+{
+	return &data->shards[g_str_hash (word) % VOIKKO_VERDICT_SHARDS];
+}
+
+/* Forget the verdict of a word */
+static void
+voikko_data_forget_verdict (VoikkoData * data, const char * word)
+{
+	VoikkoVerdictShard *shard = voikko_data_shard (data, word);
+
+	pthread_mutex_lock (&shard->lock);
+	g_hash_table_remove (shard->verdicts, word);
+	pthread_mutex_unlock (&shard->lock);
+}
+
+/* Look up the verdict of a word. Returns -1 if it is not cached. */
+static int
+voikko_data_lookup_verdict (VoikkoData * data, const char * word)
+{
+	VoikkoVerdictShard *shard = voikko_data_shard (data, word);
+	gpointer value;
+
+	pthread_mutex_lock (&shard->lock);
+	value = g_hash_table_lookup (shard->verdicts, word);
+	pthread_mutex_unlock (&shard->lock);
+
+	return GPOINTER_TO_INT (value) - 1;
+}
+
+static void
+voikko_data_store_verdict (VoikkoData * data, const char * word, int verdict)
+{
+	VoikkoVerdictShard *shard = voikko_data_shard (data, word);
+
+	pthread_mutex_lock (&shard->lock);
+	if (g_hash_table_size (shard->verdicts) >= VOIKKO_VERDICTS_PER_SHARD)
+		g_hash_table_remove_all (shard->verdicts);
+	g_hash_table_insert (shard->verdicts, g_strdup (word),
+			     GINT_TO_POINTER (verdict + 1));
+	pthread_mutex_unlock (&shard->lock);
+}
+
+/**
+ * Look up the suggestions for a word, and mark them used. Returns a copy
+ * to be freed with g_strfreev, or NULL if they are not cached.
+ */
+static char **
+voikko_data_lookup_suggestions (VoikkoData * data, const char * word)
+{
+	GList *link;
+	char **suggestions = NULL;
+
+	pthread_mutex_lock (&data->suggestion_lock);
+	link = (GList *) g_hash_table_lookup (data->suggestion_index, word);
+	if (link != NULL) {
+		g_queue_unlink (data->suggestion_lru, link);
+		g_queue_push_head_link (data->suggestion_lru, link);
+		suggestions = g_strdupv (
+			((VoikkoSuggestions *) link->data)->suggestions);
+	}
+	pthread_mutex_unlock (&data->suggestion_lock);
+
+	return suggestions;
+}
+
+/* Store a copy of the suggestions for a word, dropping the least recently
+ * used ones if the cache is full. */
+static void
+voikko_data_store_suggestions (VoikkoData * data, const char * word,
+			       char ** suggestions)
+{
+	VoikkoSuggestions *entry;
+	GList *link;
+
+	pthread_mutex_lock (&data->suggestion_lock);
+	if (g_hash_table_lookup (data->suggestion_index, word) != NULL) {
+		pthread_mutex_unlock (&data->suggestion_lock);
+		return;
+	}
+
+	if (data->suggestion_lru->length >= VOIKKO_SUGGESTION_CACHE_SIZE) {
+		link = g_queue_pop_tail_link (data->suggestion_lru);
+		entry = (VoikkoSuggestions *) link->data;
+		g_hash_table_remove (data->suggestion_index, entry->word);
+		voikko_suggestions_free (entry);
+		g_list_free_1 (link);
+	}
+
+	entry = g_new0 (VoikkoSuggestions, 1);
+	entry->word = g_strdup (word);
+	entry->suggestions = g_strdupv (suggestions);
+
+	link = g_list_alloc ();
+	link->data = entry;
+	g_queue_push_head_link (data->suggestion_lru, link);
+	g_hash_table_insert (data->suggestion_index, entry->word, link);
+	pthread_mutex_unlock (&data->suggestion_lock);
+}
+
+/* The most learned corrections to keep for a word */
+#define VOIKKO_MAX_REPLACEMENTS 8
+
+/**
+ * A dictionary: the words accepted in it and the corrections learned,
+ * answered before libvoikko is called, and the shared provider data.
+ */
+typedef struct {
+	VoikkoData *data;
+
+	/* Protects the lexicon and the replacements */
+	pthread_rwlock_t lock;
+
+	/* The personal and session words */
+	GHashTable *lexicon;
+
+	/* Map from a misspelled word to its corrections, as a NULL-terminated
+	 * array with the latest first */
+	GHashTable *replacements;
+} VoikkoDict;
+
+static VoikkoDict *
+voikko_dict_data_new (VoikkoData * data)
+{
+	VoikkoDict *vdict;
+
+	vdict = g_new0 (VoikkoDict, 1);
+	vdict->data = data;
+	pthread_rwlock_init (&vdict->lock, NULL);
+	vdict->lexicon = g_hash_table_new_full (g_str_hash, g_str_equal,
+						g_free, NULL);
+	vdict->replacements = g_hash_table_new_full (
+		g_str_hash, g_str_equal, g_free, (GDestroyNotify) g_strfreev);
+	return vdict;
+}
+
+static void
+voikko_dict_data_free (VoikkoDict * vdict)
+{
+	g_hash_table_destroy (vdict->replacements);
+	g_hash_table_destroy (vdict->lexicon);
+	pthread_rwlock_destroy (&vdict->lock);
+	g_free (vdict);
+}
+
+static int
+voikko_dict_in_lexicon (VoikkoDict * vdict, const char * word)
+{
+	int found;
+
+	pthread_rwlock_rdlock (&vdict->lock);
+	found = (g_hash_table_lookup (vdict->lexicon, word) != NULL);
+	pthread_rwlock_unlock (&vdict->lock);
+	return found;
+}
+
+static void
+voikko_dict_add_to_lexicon (EnchantDict * me, const char *const word,
+			    size_t len)
+{
+	VoikkoDict *vdict = (VoikkoDict *) me->user_data;
+	char *word_z = g_strndup (word, len);
+
+	pthread_rwlock_wrlock (&vdict->lock);
+	g_hash_table_insert (vdict->lexicon, g_strdup (word_z),
+			     GINT_TO_POINTER (1));
+	pthread_rwlock_unlock (&vdict->lock);
+
+	/* The lexicon is consulted first, but keep the cache right anyway */
+	voikko_data_forget_verdict (vdict->data, word_z);
+	g_free (word_z);
+}
+
+/**
+ * Get the corrections learned for a word followed by the other suggestions
+ * given, without duplicates. The result is to be freed with g_strfreev,
+ * and is NULL if no corrections have been learned.
+ */
+static char **
+voikko_dict_learned_suggestions (VoikkoDict * vdict, const char * word,
+				 char ** others)
+{
+	char **learned;
+	char **result = NULL;
+	size_t n_learned, n_others, n, i, j;
+
+	pthread_rwlock_rdlock (&vdict->lock);
+	learned = (char **) g_hash_table_lookup (vdict->replacements, word);
+	if (learned != NULL) {
+		n_learned = g_strv_length (learned);
+		n_others = others ? g_strv_length (others) : 0;
+		result = g_new0 (char *, n_learned + n_others + 1);
+
+		for (n = 0; n < n_learned; n++)
+			result[n] = g_strdup (learned[n]);
+		for (i = 0; i < n_others; i++) {
+			for (j = 0; j < n_learned; j++)
+				if (strcmp (others[i], learned[j]) == 0)
+					break;
+			if (j == n_learned)
+				result[n++] = g_strdup (others[i]);
+		}
+	}
+	pthread_rwlock_unlock (&vdict->lock);
+
+	return result;
+}
+
+/* Remember that a misspelled word was corrected to the given word */
+static void
+voikko_dict_store_replacement (EnchantDict * me,
+			       const char *const mis, size_t mis_len,
+			       const char *const cor, size_t cor_len)
+{
+	VoikkoDict *vdict = (VoikkoDict *) me->user_data;
+	char *mis_z = g_strndup (mis, mis_len);
+	char **old;
+	char **corrections;
+	size_t n, i;
+
+	pthread_rwlock_wrlock (&vdict->lock);
+	old = (char **) g_hash_table_lookup (vdict->replacements, mis_z);
+
+	corrections = g_new0 (char *, VOIKKO_MAX_REPLACEMENTS + 1);
+	corrections[0] = g_strndup (cor, cor_len);
+	n = 1;
+	for (i = 0; old && old[i] && n < VOIKKO_MAX_REPLACEMENTS; i++) {
+		if (strcmp (old[i], corrections[0]) != 0)
+			corrections[n++] = g_strdup (old[i]);
+	}
+
+	g_hash_table_insert (vdict->replacements, mis_z, corrections);
+	pthread_rwlock_unlock (&vdict->lock);
+}
+
 static int
 voikko_dict_check (EnchantDict * me, const char *const word, size_t len)
 {
 	int result;
 	int voikko_handle;
+	VoikkoDict *vdict = (VoikkoDict *) me->user_data;
+	VoikkoData *data = vdict->data;
+	char *word_z;
 
-	voikko_handle = (long) me->user_data;
-	result = voikko_spell_cstr(voikko_handle, word);
-	if (result == VOIKKO_SPELL_FAILED)
-		return 1;
-	else if (result == VOIKKO_SPELL_OK)
+	/* The word need not be terminated */
+	word_z = g_strndup (word, len);
+
+	if (voikko_dict_in_lexicon (vdict, word_z)) {
+		g_free (word_z);
 		return 0;
-	else
-		return -1;
+	}
+
+	result = voikko_data_lookup_verdict (data, word_z);
+	if (result < 0) {
+		if (voikko_pool_checkout (data->pool, &voikko_handle) != NULL) {
+			g_free (word_z);
+			return -1;
+		}
+		result = voikko_spell_cstr(voikko_handle, word_z);
+		voikko_pool_checkin (data->pool, voikko_handle);
+
+		if (result == VOIKKO_SPELL_FAILED)
+			result = 1;
+		else if (result == VOIKKO_SPELL_OK)
+			result = 0;
+		else
+			result = -1;
+
+		if (result >= 0)
+			voikko_data_store_verdict (data, word_z, result);
+	}
+
+	g_free (word_z);
+	return result;
 }
 
 static char **
@@ -68,37 +612,81 @@ voikko_dict_suggest (EnchantDict * me, const char *const word,
 		     size_t len, size_t * out_n_suggs)
 {
 	char **sugg_arr;
+	char **voikko_sugg_arr;
+	char **learned;
 	int voikko_handle;
+	VoikkoDict *vdict = (VoikkoDict *) me->user_data;
+	VoikkoData *data = vdict->data;
+	char *word_z;
 
-	voikko_handle = (long) me->user_data;
-	sugg_arr = voikko_suggest_cstr(voikko_handle, word);
-	if (sugg_arr == NULL)
-		return NULL;
+	word_z = g_strndup (word, len);
+
+	/* The learned corrections come first, and the suggester is run only
+	 * if there are none */
+	sugg_arr = voikko_data_lookup_suggestions (data, word_z);
+	learned = voikko_dict_learned_suggestions (vdict, word_z, sugg_arr);
+	if (learned != NULL) {
+		g_strfreev (sugg_arr);
+		sugg_arr = learned;
+	}
+
+	if (sugg_arr == NULL) {
+		if (voikko_pool_checkout (data->pool, &voikko_handle) != NULL) {
+			g_free (word_z);
+			return NULL;
+		}
+		voikko_sugg_arr = voikko_suggest_cstr(voikko_handle, word_z);
+		voikko_pool_checkin (data->pool, voikko_handle);
+
+		if (voikko_sugg_arr == NULL) {
+			g_free (word_z);
+			return NULL;
+		}
+
+		/* Enchant frees the list with g_strfreev */
+		sugg_arr = g_strdupv (voikko_sugg_arr);
+		voikko_free_suggest_cstr (voikko_sugg_arr);
+		voikko_data_store_suggestions (data, word_z, sugg_arr);
+	}
+
+	g_free (word_z);
 	for (*out_n_suggs = 0; sugg_arr[*out_n_suggs] != NULL; (*out_n_suggs)++);
 	return sugg_arr;
 }
 
+
 static EnchantDict *
 voikko_provider_request_dict (EnchantProvider * me, const char *const tag)
 {
 	EnchantDict *dict;
 	const char * voikko_error;
 	int voikko_handle;
+	VoikkoData *data = (VoikkoData *) me->user_data;
+	VoikkoPool *pool = data->pool;
 
 	/* Only Finnish is supported at the moment */
 	if (strncmp(tag, "fi_FI", 6) != 0 && strncmp(tag, "fi", 3) != 0)
 		return NULL;
-	
-	voikko_error = voikko_init(&voikko_handle, "fi_FI", 0);
+
+	/* Make sure that there is a handle to use */
+	voikko_error = voikko_pool_checkout (pool, &voikko_handle);
 	if (voikko_error) {
 		enchant_provider_set_error(me, voikko_error);
 		return NULL;
 	}
+	voikko_pool_checkin (pool, voikko_handle);
+
+	pthread_mutex_lock (&pool->lock);
+	pool->n_dicts++;
+	pthread_mutex_unlock (&pool->lock);
 
 	dict = g_new0 (EnchantDict, 1);
-	dict->user_data = (void *)(long) voikko_handle;
+	dict->user_data = voikko_dict_data_new (data);
 	dict->check = voikko_dict_check;
 	dict->suggest = voikko_dict_suggest;
+	dict->add_to_personal = voikko_dict_add_to_lexicon;
+	dict->add_to_session = voikko_dict_add_to_lexicon;
+	dict->store_replacement = voikko_dict_store_replacement;
 
 	return dict;
 }
@@ -106,7 +694,15 @@ voikko_provider_request_dict (EnchantProvider * me, const char *const tag)
 static void
 voikko_provider_dispose_dict (EnchantProvider * me, EnchantDict * dict)
 {
-	voikko_terminate((long) dict->user_data);
+	VoikkoDict *vdict = (VoikkoDict *) dict->user_data;
+	VoikkoPool *pool = vdict->data->pool;
+
+	pthread_mutex_lock (&pool->lock);
+	if (--pool->n_dicts == 0)
+		voikko_pool_clear (pool);
+	pthread_mutex_unlock (&pool->lock);
+
+	voikko_dict_data_free (vdict);
 	g_free (dict);
 }
 
@@ -114,18 +710,12 @@ static int
 voikko_provider_dictionary_exists (struct str_enchant_provider * me,
                                    const char *const tag)
 {
-	int voikko_handle;
-
 	/* Only Finnish is supported */
 	if (strncmp(tag, "fi_FI", 6) != 0 && strncmp(tag, "fi", 3) != 0)
 		return 0;
 
 	/* Check that a dictionary is actually available */
-	if (voikko_init(&voikko_handle, "fi_FI", 0) == NULL) {
-		voikko_terminate(voikko_handle);
-		return 1;
-	}
-	else return 0;
+	return voikko_data_probe ((VoikkoData *) me->user_data);
 }
 
 
@@ -134,11 +724,9 @@ voikko_provider_list_dicts (EnchantProvider * me,
 			    size_t * out_n_dicts)
 {
 	char ** out_list = NULL;
-	int voikko_handle;
 	*out_n_dicts = 0;
 
-	if (voikko_init(&voikko_handle, "fi_FI", 0) == NULL) {
-		voikko_terminate(voikko_handle);
+	if (voikko_data_probe ((VoikkoData *) me->user_data)) {
 		*out_n_dicts = 2;
 		out_list = g_new0 (char *, *out_n_dicts + 1);
 		out_list[0] = g_strdup("fi_FI");
@@ -157,6 +745,7 @@ voikko_provider_free_string_list (EnchantProvider * me, char **str_list)
 static void
 voikko_provider_dispose (EnchantProvider * me)
 {
+	voikko_data_free ((VoikkoData *) me->user_data);
 	g_free (me);
 }
 
@@ -182,6 +771,7 @@ init_enchant_provider (void)
 	EnchantProvider *provider;
 
 	provider = g_new0 (EnchantProvider, 1);
+	provider->user_data = voikko_data_new ();
 	provider->dispose = voikko_provider_dispose;
 	provider->request_dict = voikko_provider_request_dict;
 	provider->dispose_dict = voikko_provider_dispose_dict;
@@ -197,3 +787,81 @@ init_enchant_provider (void)
 #ifdef __cplusplus
 }
 #endif
+
+#if TEST
+
+/*
+ * A stress test of the handle pool and the caches: eight threads check
+ * and suggest on one dictionary, built against the libvoikko stub of the
+ * benchmarks, which rejects the words with a q or an x in them. Build it
+ * with -fsanitize=thread to look for data races as well.
+ */
+
+#define TEST_THREADS 8
+#define TEST_WORDS 100000
+
+static EnchantDict *test_dict;
+static int test_failures;
+
+static void *
+test_run (void *arg)
+{
+	char word[32];
+	size_t n_suggs;
+	char **suggs;
+	int i, misspelled, result;
+	long first = (long) arg;
+
+	for (i = 0; i < TEST_WORDS; i++) {
+		/* More distinct words than the verdict cache holds */
+		misspelled = (i % 3 == 0);
+		snprintf (word, sizeof (word), "%ssana%ld",
+			  misspelled ? "x" : "", (first + i) % 100000);
+
+		result = test_dict->check (test_dict, word, strlen (word));
+		if (result != misspelled)
+			__sync_add_and_fetch (&test_failures, 1);
+
+		if (misspelled && i % 100 == 0) {
+			suggs = test_dict->suggest (test_dict, word,
+						    strlen (word), &n_suggs);
+			if (suggs == NULL || n_suggs == 0)
+				__sync_add_and_fetch (&test_failures, 1);
+			g_strfreev (suggs);
+		}
+	}
+	return NULL;
+}
+
+int
+main (void)
+{
+	EnchantProvider *provider;
+	EnchantDict *other;
+	pthread_t threads[TEST_THREADS];
+	long i;
+
+	provider = init_enchant_provider ();
+	if (!provider->dictionary_exists (provider, "fi")) {
+		fprintf (stderr, "No dictionary\n");
+		return 1;
+	}
+
+	test_dict = provider->request_dict (provider, "fi");
+	other = provider->request_dict (provider, "fi_FI");
+
+	for (i = 0; i < TEST_THREADS; i++)
+		pthread_create (&threads[i], NULL, test_run,
+				(void *) (i * 12345));
+	for (i = 0; i < TEST_THREADS; i++)
+		pthread_join (threads[i], NULL);
+
+	provider->dispose_dict (provider, other);
+	provider->dispose_dict (provider, test_dict);
+	provider->dispose (provider);
+
+	printf ("%d wrong results\n", test_failures);
+	return test_failures != 0;
+}
+
+#endif
@@ -0,0 +1,630 @@
+/* Copyright (C) Pauli Virtanen
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *********************************************************************************/
+
+/**
+ * @file bench.cc
+ *
+ * Benchmarks of the filters, the character set conversion, the personal
+ * dictionary and the -l and -a modes. Linked against the stub libvoikko
+ * of voikko_stub.cc, so the results do not depend on the dictionary.
+ *
+ * Usage: tmispell-bench [-n lines] [-r repeat] [-s seed]
+ *
+ * The results are written to standard output as one JSON object:
+ *
+ *   { "version": 1, "lines": 20000, "repeat": 3, "seed": 1,
+ *     "results": [
+ *       { "name": "filter.plain", "unit": "words", "items": 152000,
+ *         "bytes": 1203310, "seconds": 0.0412,
+ *         "items_per_second": 3689320, "bytes_per_second": 29206553 },
+ *       ... ] }
+ *
+ * Each benchmark is run repeat times, and the fastest run is reported.
+ * The input is made by CorpusGenerator with its default settings.
+ */
+#include <string>
+#include <vector>
+#include <sstream>
+#include <fstream>
+#include <iostream>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <dirent.h>
+
+#include "glibmm/ustring.h"
+#include "glibmm/error.h"
+#include "glibmm/convert.h"
+
+#include <glib.h>
+
+#include "config.hh"
+#include "common.hh"
+#include "i18n.hh"
+#include "charset.hh"
+#include "config_file.hh"
+#include "corpus.hh"
+#include "filter.hh"
+#include "options.hh"
+#include "personal_dictionary.hh"
+#include "statistics.hh"
+#include "tmispell.hh"
+
+/// Defined in tmispell.cc
+void throw_glib_convert_error_func(GError* gobject);
+
+/****************************************************************************/
+/** @name Benchmark input
+ ** @{
+ **/
+
+/**
+ * Make the input text for the given filter.
+ */
+static void make_text(Options::FilterType type, unsigned long lines,
+		      unsigned long seed, std::vector<Glib::ustring>& text)
+{
+	CorpusGenerator::Settings settings;
+	settings.seed = seed;
+	settings.type = type;
+
+	CorpusGenerator generator(settings);
+	std::string line;
+	text.clear();
+	for (unsigned long i = 0; i < lines; ++i) {
+		generator.next_line(line);
+		text.push_back(Glib::ustring(line));
+	}
+}
+
+/** The total size of text in bytes, with line feeds */
+static unsigned long text_bytes(std::vector<Glib::ustring> const& text)
+{
+	unsigned long bytes = 0;
+	for (unsigned long i = 0; i < text.size(); ++i)
+		bytes += text[i].bytes() + 1;
+	return bytes;
+}
+
+/** @} */
+
+
+/****************************************************************************/
+/** @name Running and reporting
+ ** @{
+ **/
+
+/** The result of one benchmark */
+struct BenchResult
+{
+	/// Name of the benchmark
+	std::string name;
+	/// What the items are
+	char const* unit;
+	/// The number of items processed per run
+	unsigned long items;
+	/// The number of bytes processed per run
+	unsigned long bytes;
+	/// The duration of the fastest run
+	double seconds;
+};
+
+/** The benchmark parameters */
+struct BenchSettings
+{
+	unsigned long lines;
+	unsigned long repeat;
+	unsigned long seed;
+	std::string tmpdir;
+};
+
+/**
+ * A benchmark: run() does the work once and returns the number of items
+ * processed.
+ */
+class Benchmark
+{
+public:
+	virtual ~Benchmark() {}
+	virtual unsigned long run() = 0;
+};
+
+/**
+ * Run a benchmark repeatedly and keep the fastest run.
+ */
+static BenchResult measure(BenchSettings const& settings,
+			   std::string const& name, char const* unit,
+			   unsigned long bytes, Benchmark& bench)
+{
+	BenchResult result;
+	result.name = name;
+	result.unit = unit;
+	result.items = 0;
+	result.bytes = bytes;
+	result.seconds = -1;
+
+	for (unsigned long i = 0; i < settings.repeat; ++i) {
+		long long start = Statistics::now();
+		result.items = bench.run();
+		double seconds = (Statistics::now() - start) * 1e-9;
+		if (result.seconds < 0 || seconds < result.seconds)
+			result.seconds = seconds;
+	}
+	return result;
+}
+
+/** Write a string as a JSON string literal */
+static void write_json_string(std::ostream& out, std::string const& str)
+{
+	out << '"';
+	for (std::string::const_iterator i = str.begin(); i != str.end(); ++i){
+		if (*i == '"' || *i == '\\') out << '\\';
+		out << *i;
+	}
+	out << '"';
+}
+
+/** Write all results as a JSON object */
+static void write_json(std::ostream& out, BenchSettings const& settings,
+		       std::vector<BenchResult> const& results)
+{
+	out << "{ \"version\": 1, \"lines\": " << settings.lines
+	    << ", \"repeat\": " << settings.repeat
+	    << ", \"seed\": " << settings.seed << ",\n  \"results\": [\n";
+
+	for (unsigned long i = 0; i < results.size(); ++i) {
+		BenchResult const& r = results[i];
+		double s = r.seconds > 0 ? r.seconds : 1e-9;
+
+		out << "    { \"name\": ";
+		write_json_string(out, r.name);
+		out << ", \"unit\": ";
+		write_json_string(out, r.unit);
+		out << ", \"items\": " << r.items
+		    << ", \"bytes\": " << r.bytes
+		    << ", \"seconds\": " << r.seconds
+		    << ", \"items_per_second\": "
+		    << (unsigned long)(r.items / s)
+		    << ", \"bytes_per_second\": "
+		    << (unsigned long)(r.bytes / s)
+		    << " }" << (i + 1 < results.size() ? ",\n" : "\n");
+	}
+	out << "  ] }" << std::endl;
+}
+
+/** @} */
+
+
+/****************************************************************************/
+/** @name The benchmarks
+ ** @{
+ **/
+
+/**
+ * Split every line into words with a filter.
+ */
+class FilterBenchmark : public Benchmark
+{
+public:
+	FilterBenchmark(Filter* filter, std::vector<Glib::ustring> const& text)
+		: filter_(filter), text_(text) {}
+	~FilterBenchmark() { delete filter_; }
+
+	unsigned long run() {
+		unsigned long words = 0;
+		for (unsigned long i = 0; i < text_.size(); ++i) {
+			filter_->set_line(&text_[i]);
+			Glib::ustring::const_iterator begin, end;
+			while (filter_->next_word(&begin, &end))
+				++words;
+		}
+		return words;
+	}
+
+private:
+	Filter* filter_;
+	std::vector<Glib::ustring> const& text_;
+};
+
+/**
+ * Convert every line from an external encoding to UTF-8.
+ */
+class ConvertFromBenchmark : public Benchmark
+{
+public:
+	ConvertFromBenchmark(CharsetConverter& conv,
+			     std::vector<std::string> const& text)
+		: conv_(conv), text_(text) {}
+
+	unsigned long run() {
+		for (unsigned long i = 0; i < text_.size(); ++i)
+			conv_.from(text_[i]);
+		return text_.size();
+	}
+
+private:
+	CharsetConverter& conv_;
+	std::vector<std::string> const& text_;
+};
+
+/**
+ * Convert every line from UTF-8 to an external encoding.
+ */
+class ConvertToBenchmark : public Benchmark
+{
+public:
+	ConvertToBenchmark(CharsetConverter& conv,
+			   std::vector<Glib::ustring> const& text)
+		: conv_(conv), text_(text) {}
+
+	unsigned long run() {
+		for (unsigned long i = 0; i < text_.size(); ++i)
+			conv_.to(text_[i]);
+		return text_.size();
+	}
+
+private:
+	CharsetConverter& conv_;
+	std::vector<Glib::ustring> const& text_;
+};
+
+/**
+ * Load a personal dictionary file.
+ */
+class DictionaryLoadBenchmark : public Benchmark
+{
+public:
+	DictionaryLoadBenchmark(std::string const& file, unsigned long words)
+		: file_(file), words_(words) {}
+
+	unsigned long run() {
+		PersonalDictionary dict;
+		dict.load(file_);
+		return words_;
+	}
+
+private:
+	std::string file_;
+	unsigned long words_;
+};
+
+/**
+ * Look words up in a personal dictionary.
+ */
+class DictionaryLookupBenchmark : public Benchmark
+{
+public:
+	DictionaryLookupBenchmark(PersonalDictionary const& dict,
+				  std::vector<Glib::ustring> const& words)
+		: dict_(dict), words_(words), found_(0) {}
+
+	unsigned long run() {
+		found_ = 0;
+		for (unsigned long i = 0; i < words_.size(); ++i)
+			if (dict_.check_word(words_[i])) ++found_;
+		return words_.size();
+	}
+
+private:
+	PersonalDictionary const& dict_;
+	std::vector<Glib::ustring> const& words_;
+	/// The number of words found, kept so that the lookups are not elided
+	unsigned long found_;
+};
+
+/**
+ * Run tmispell end to end with the given arguments, reading the input
+ * from a file and discarding the output. The file is put on descriptor 0
+ * for the run, as the interfaces read standard input from there.
+ */
+class EndToEndBenchmark : public Benchmark
+{
+public:
+	EndToEndBenchmark(std::vector<std::string> const& args,
+			  std::string const& input_file, unsigned long words)
+		: args_(args), input_file_(input_file), words_(words) {}
+
+	unsigned long run() {
+		std::vector<char*> argv;
+		for (unsigned long i = 0; i < args_.size(); ++i)
+			argv.push_back(const_cast<char*>(args_[i].c_str()));
+		argv.push_back(0);
+
+		int fd = open(input_file_.c_str(), O_RDONLY);
+		if (fd < 0) {
+			throw Error("Unable to open file %s",
+				    input_file_.c_str());
+		}
+		int saved_stdin = dup(STDIN_FILENO);
+		if (saved_stdin < 0 || dup2(fd, STDIN_FILENO) < 0) {
+			close(fd);
+			if (saved_stdin >= 0) close(saved_stdin);
+			throw Error("Unable to redirect standard input");
+		}
+		close(fd);
+
+		std::ostringstream out;
+		std::streambuf* cout_buf = std::cout.rdbuf(out.rdbuf());
+		try {
+			IspellAlike ispellalike(argv.size() - 1, &argv[0]);
+			ispellalike.start();
+		} catch (...) {
+			restore(saved_stdin, cout_buf);
+			throw;
+		}
+		restore(saved_stdin, cout_buf);
+		return words_;
+	}
+
+private:
+	/// Put back the original standard input and output
+	static void restore(int saved_stdin, std::streambuf* cout_buf) {
+		dup2(saved_stdin, STDIN_FILENO);
+		close(saved_stdin);
+		clearerr(stdin);
+		std::cin.clear();
+		std::cout.rdbuf(cout_buf);
+	}
+
+	std::vector<std::string> args_;
+	std::string input_file_;
+	unsigned long words_;
+};
+
+/** @} */
+
+
+/****************************************************************************/
+/** @name Main program
+ ** @{
+ **/
+
+/** Write a file, throwing on failure */
+static void write_file(std::string const& path, std::string const& data)
+{
+	std::ofstream f(path.c_str());
+	f << data;
+	if (!f) throw Error("Unable to write to file %s", path.c_str());
+}
+
+/** Remove the temporary directory and the configuration cache in it */
+static void remove_tmpdir(std::string const& tmpdir)
+{
+	std::string cachedir = tmpdir + "/tmispell";
+	DIR* dir = opendir(cachedir.c_str());
+	if (dir) {
+		struct dirent* ent;
+		while ((ent = readdir(dir)) != 0) {
+			if (ent->d_name[0] != '.')
+				unlink((cachedir + "/" + ent->d_name).c_str());
+		}
+		closedir(dir);
+		rmdir(cachedir.c_str());
+	}
+	unlink((tmpdir + "/tmispell.conf").c_str());
+	unlink((tmpdir + "/personal").c_str());
+	unlink((tmpdir + "/words").c_str());
+	unlink((tmpdir + "/list_input").c_str());
+	unlink((tmpdir + "/pipe_input").c_str());
+	rmdir(tmpdir.c_str());
+}
+
+/** The configuration file for the end to end runs */
+static char const bench_config[] =
+	"ispell = /bin/false\n"
+	"tex-command-filter = \"begin po, end p, label p, ref p, cite p\"\n"
+	"tex-environment-filter = \"equation $ displaymath math\"\n"
+	"sgml-attributes-to-check = \"alt\"\n"
+	"suomi \"/dev/null\" \"/dev/null\" \"UTF-8\" \"fi_FI.UTF-8\""
+	" \".-\" \"'\xe2\x80\x99:\"\n";
+
+static void run_benchmarks(BenchSettings const& settings,
+			   std::vector<BenchResult>& results)
+{
+	static struct {
+		Options::FilterType type;
+		char const* name;
+	} const filters[] = {
+		{ Options::plain, "plain" },
+		{ Options::tex, "tex" },
+		{ Options::nroff, "nroff" },
+		{ Options::sgml, "sgml" },
+		{ Options::markdown, "markdown" },
+		{ Options::csource, "csource" },
+		{ Options::script, "script" }
+	};
+
+	std::string conf = settings.tmpdir + "/tmispell.conf";
+	std::string personal = settings.tmpdir + "/personal";
+	write_file(conf, bench_config);
+	write_file(personal, "");
+
+	// Set up the filter options like IspellAlike::start does
+	ConfigFile conffile(conf);
+	char const* opt_argv[] = { "tmispell", 0 };
+	Options options(1, const_cast<char* const*>(opt_argv));
+	options.spellchecker_entry_ = &conffile.get("suomi");
+	options.tex_command_filter_
+		= conffile.get_option("tex-command-filter");
+	options.tex_environment_filter_
+		= conffile.get_option("tex-environment-filter");
+	options.sgml_attributes_to_check_
+		= conffile.get_option("sgml-attributes-to-check");
+
+	// Filters
+	for (unsigned i = 0; i < sizeof(filters) / sizeof(filters[0]); ++i) {
+		std::vector<Glib::ustring> text;
+		make_text(filters[i].type, settings.lines, settings.seed, text);
+
+		FilterBenchmark bench(
+			Filter::new_filter(filters[i].type, options), text);
+		results.push_back(measure(settings,
+			std::string("filter.") + filters[i].name, "words",
+			text_bytes(text), bench));
+	}
+
+	std::vector<Glib::ustring> text;
+	make_text(Options::plain, settings.lines, settings.seed, text);
+	unsigned long bytes = text_bytes(text);
+
+	// Character set conversion
+	{
+		CharsetConverter conv("ISO-8859-15");
+		std::vector<std::string> latin9;
+		for (unsigned long i = 0; i < text.size(); ++i)
+			latin9.push_back(conv.to(text[i]));
+
+		ConvertFromBenchmark from(conv, latin9);
+		results.push_back(measure(settings, "charset.from", "lines",
+					  bytes, from));
+		ConvertToBenchmark to(conv, text);
+		results.push_back(measure(settings, "charset.to", "lines",
+					  bytes, to));
+	}
+
+	// Words of the text, and a personal dictionary of every other one
+	std::vector<Glib::ustring> words;
+	{
+		Filter* f = Filter::new_filter(Options::plain, options);
+		for (unsigned long i = 0; i < text.size(); ++i) {
+			f->set_line(&text[i]);
+			Glib::ustring::const_iterator begin, end;
+			while (f->next_word(&begin, &end))
+				words.push_back(Glib::ustring(begin, end));
+		}
+		delete f;
+	}
+
+	std::string dict_file = settings.tmpdir + "/words";
+	PersonalDictionary dict;
+	for (unsigned long i = 0; i < words.size(); i += 2) {
+		dict.add_word(words[i]);
+	}
+	dict.save(dict_file);
+	{
+		std::ifstream f(dict_file.c_str());
+		std::string line;
+		unsigned long n = 0, size = 0;
+		while (std::getline(f, line)) {
+			++n;
+			size += line.size() + 1;
+		}
+
+		DictionaryLoadBenchmark load(dict_file, n);
+		results.push_back(measure(settings, "personal_dictionary.load",
+					  "words", size, load));
+	}
+	{
+		DictionaryLookupBenchmark lookup(dict, words);
+		results.push_back(measure(settings,
+					  "personal_dictionary.lookup",
+					  "words", 0, lookup));
+	}
+
+	// End to end
+	std::string list_input, pipe_input;
+	for (unsigned long i = 0; i < text.size(); ++i) {
+		list_input += text[i].raw() + "\n";
+		pipe_input += "^" + text[i].raw() + "\n";
+	}
+
+	std::vector<std::string> args;
+	args.push_back("tmispell");
+	args.push_back("-F");
+	args.push_back(conf);
+	args.push_back("-d");
+	args.push_back("suomi");
+	args.push_back("-p");
+	args.push_back(personal);
+	args.push_back("-r");
+	args.push_back("UTF-8");
+
+	std::string list_file = settings.tmpdir + "/list_input";
+	std::string pipe_file = settings.tmpdir + "/pipe_input";
+	write_file(list_file, list_input);
+	write_file(pipe_file, pipe_input);
+
+	args.push_back("-l");
+	EndToEndBenchmark list(args, list_file, words.size());
+	results.push_back(measure(settings, "end_to_end.list", "words",
+				  list_input.size(), list));
+
+	args.back() = "-a";
+	EndToEndBenchmark pipe(args, pipe_file, words.size());
+	results.push_back(measure(settings, "end_to_end.pipe", "words",
+				  pipe_input.size(), pipe));
+}
+
+int main(int argc, char* const* argv)
+{
+	BenchSettings settings;
+	settings.lines = 20000;
+	settings.repeat = 3;
+	settings.seed = 1;
+
+	int opt;
+	while ((opt = getopt(argc, argv, "n:r:s:")) != -1) {
+		switch (opt) {
+		case 'n': settings.lines = strtoul(optarg, 0, 10); break;
+		case 'r': settings.repeat = strtoul(optarg, 0, 10); break;
+		case 's': settings.seed = strtoul(optarg, 0, 10); break;
+		default:
+			fprintf(stderr, "Usage: %s [-n lines] [-r repeat] "
+				"[-s seed]\n", argv[0]);
+			return 2;
+		}
+	}
+	if (settings.repeat == 0) settings.repeat = 1;
+
+	locale_init();
+	Glib::Error::register_init();
+	Glib::Error::register_domain(
+		g_quark_from_static_string("g_convert_error"),
+		&throw_glib_convert_error_func);
+
+	char const* tmp = getenv("TMPDIR");
+	std::string pattern = std::string(tmp && *tmp ? tmp : "/tmp")
+		+ "/tmispell-bench-XXXXXX";
+	std::vector<char> buf(pattern.begin(), pattern.end());
+	buf.push_back('\0');
+	if (mkdtemp(&buf[0]) == 0) {
+		perror("mkdtemp");
+		return 1;
+	}
+	settings.tmpdir = &buf[0];
+
+	// Keep the configuration cache out of the user's cache directory
+	setenv("XDG_CACHE_HOME", settings.tmpdir.c_str(), 1);
+
+	std::vector<BenchResult> results;
+	int status = 0;
+	try {
+		run_benchmarks(settings, results);
+		write_json(std::cout, settings, results);
+	} catch (Error const& err) {
+		std::cerr << err.what() << std::endl;
+		status = 1;
+	}
+
+	remove_tmpdir(settings.tmpdir);
+	return status;
+}
+
+/** @} */
@@ -0,0 +1,304 @@
+/* Copyright (C) Pauli Virtanen
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *********************************************************************************/
+
+/**
+ * @file corpus.cc
+ *
+ * Generating synthetic Finnish-like text for benchmarks and load tests.
+ */
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <math.h>
+#include <string.h>
+
+#include "corpus.hh"
+
+/**
+ * The syllables of the words. Each is two characters long, so that
+ * different strings of syllables never give the same word.
+ */
+static char const* const syllables[] = {
+	"ka", "ta", "la", "si", "vi", "ne", "ri", "tu", "hy", "pa", "jo",
+	"ul", "en", "oi", "ko", "mi", "se", "in", "an", "el", "ht", "uu",
+	"m\xc3\xa4", "k\xc3\xb6", "t\xc3\xa4", "y\xc3\xb6", "\xc3\xa4\xc3\xa4",
+	"s\xc3\xa4", "l\xc3\xb6", "n\xc3\xa4"
+};
+
+/** The number of syllables */
+static unsigned long const syllable_count
+	= sizeof(syllables) / sizeof(syllables[0]);
+
+CorpusGenerator::Settings::Settings()
+	: seed(1), vocabulary(50000), zipf(1.0), misspelling_rate(0.03),
+	  line_words(10), markup_density(0.1), type(Options::plain)
+{
+}
+
+/**
+ * Make the vocabulary and its distribution. The word of rank r is the
+ * bijective base-n numeral of r + 1, with syllables as the digits in an
+ * order shuffled by the seed.
+ */
+CorpusGenerator::CorpusGenerator(Settings const& settings)
+	: settings_(settings), rnd_(settings.seed), in_comment_(false)
+{
+	if (settings_.vocabulary == 0) settings_.vocabulary = 1;
+	if (settings_.line_words == 0) settings_.line_words = 1;
+
+	std::vector<char const*> digits(syllables,
+					syllables + syllable_count);
+	for (unsigned long i = syllable_count - 1; i > 0; --i) {
+		std::swap(digits[i], digits[rnd_.next(i + 1)]);
+	}
+
+	words_.reserve(settings_.vocabulary);
+	cumulative_.reserve(settings_.vocabulary);
+
+	double total = 0;
+	for (unsigned long r = 0; r < settings_.vocabulary; ++r) {
+		std::string word;
+		for (unsigned long n = r + 1; n > 0;
+		     n = (n - 1) / syllable_count) {
+			word += digits[(n - 1) % syllable_count];
+		}
+		words_.push_back(word);
+
+		total += 1.0 / pow(r + 1.0, settings_.zipf);
+		cumulative_.push_back(total);
+	}
+	for (unsigned long r = 0; r < cumulative_.size(); ++r) {
+		cumulative_[r] /= total;
+	}
+}
+
+std::string const& CorpusGenerator::pick_word()
+{
+	double x = rnd_.next_double();
+	std::vector<double>::const_iterator p =
+		std::upper_bound(cumulative_.begin(), cumulative_.end(), x);
+	if (p == cumulative_.end()) --p;
+	return words_[p - cumulative_.begin()];
+}
+
+/**
+ * Append a word. A misspelling replaces an ASCII letter of the word with
+ * q or x, or adds an x. Capitalization works for ASCII letters, ä and ö.
+ */
+void CorpusGenerator::append_word(std::string& line, std::string word,
+				  bool capitalize)
+{
+	if (rnd_.next_double() < settings_.misspelling_rate) {
+		std::string::size_type pos = rnd_.next(word.size());
+		while (pos > 0 && (unsigned char)word[pos] >= 0x80) --pos;
+		if ((unsigned char)word[pos] < 0x80)
+			word[pos] = rnd_.next(2) ? 'q' : 'x';
+		else
+			word.insert(pos, 1, 'x');
+	}
+
+	if (capitalize) {
+		if ((unsigned char)word[0] < 0x80)
+			word[0] = word[0] - 'a' + 'A';
+		else if (word.size() > 1)
+			word[1] = word[1] - 0x20;
+	}
+
+	if (settings_.type == Options::plain ||
+	    rnd_.next_double() >= settings_.markup_density) {
+		line += word;
+		return;
+	}
+
+	switch (settings_.type) {
+	case Options::tex:
+		switch (rnd_.next(4)) {
+		case 0: line += "\\emph{" + word + "}"; break;
+		case 1: line += "\\textbf{" + word + "}"; break;
+		case 2: line += word + "~\\ref{kuva:" + word + "}"; break;
+		default: line += word + " $x_{i}^2$"; break;
+		}
+		break;
+	case Options::nroff:
+		switch (rnd_.next(3)) {
+		case 0: line += "\\fB" + word + "\\fR"; break;
+		case 1: line += "\\fI" + word + "\\fP"; break;
+		default: line += "\\(lq" + word + "\\(rq"; break;
+		}
+		break;
+	case Options::sgml:
+		switch (rnd_.next(4)) {
+		case 0: line += "<em>" + word + "</em>"; break;
+		case 1:
+			line += "<a href=\"http://example.org/" + word + "\">"
+				+ word + "</a>";
+			break;
+		case 2:
+			line += "<img src=\"kuva.png\" alt=\"" + word + "\">";
+			break;
+		default: line += word + "&nbsp;&ndash;"; break;
+		}
+		break;
+	case Options::markdown:
+		switch (rnd_.next(4)) {
+		case 0: line += "*" + word + "*"; break;
+		case 1: line += "`" + word + "()`"; break;
+		case 2:
+			line += "[" + word + "](http://example.org/" + word
+				+ ")";
+			break;
+		default: line += word + " <https://example.org/>"; break;
+		}
+		break;
+	case Options::csource:
+		switch (rnd_.next(3)) {
+		case 0: line += word + "()"; break;
+		case 1: line += word + " %d"; break;
+		default: line += "<" + word + ".h>"; break;
+		}
+		break;
+	case Options::script:
+		switch (rnd_.next(3)) {
+		case 0: line += word + "()"; break;
+		case 1: line += "$" + word; break;
+		default: line += word + " %s"; break;
+		}
+		break;
+	default:
+		line += word;
+		break;
+	}
+}
+
+/**
+ * Lines of markup: requests, environments, comments and so on.
+ * Environments are closed on the same line, so that the following lines
+ * are not filtered out.
+ */
+char const* CorpusGenerator::markup_line()
+{
+	static char const* const tex_lines[] = {
+		"\\begin{equation} x^2 + y^2 = z^2 \\end{equation}",
+		"\\section{Johdanto}", "\\label{sec:johdanto}",
+		"\\cite{virtanen2008}", "\\hspace{1cm}"
+	};
+	static char const* const nroff_lines[] = {
+		".PP", ".SH KUVAUS", ".TP", ".br", ".\\\" kommentti"
+	};
+	static char const* const sgml_lines[] = {
+		"<p>", "</p>", "<div class=\"osio\">", "</div>",
+		"<!-- kommentti -->"
+	};
+	static char const* const markdown_lines[] = {
+		"## Johdanto", "* * *", "[viite]: http://example.org/",
+		"<!-- kommentti -->", "> Huomautus"
+	};
+	static char const* const csource_lines[] = {
+		"#include <stdio.h>", "int main(int argc, char** argv)", "{",
+		"\treturn 0;", "}"
+	};
+	static char const* const script_lines[] = {
+		"import os", "def main(argv):", "    return 0", "fi", "done"
+	};
+
+	if (rnd_.next_double() >= settings_.markup_density / 2) return 0;
+
+	switch (settings_.type) {
+	case Options::tex: return tex_lines[rnd_.next(5)];
+	case Options::nroff: return nroff_lines[rnd_.next(5)];
+	case Options::sgml: return sgml_lines[rnd_.next(5)];
+	case Options::markdown: return markdown_lines[rnd_.next(5)];
+	case Options::csource: return csource_lines[rnd_.next(5)];
+	case Options::script: return script_lines[rnd_.next(5)];
+	default: return 0;
+	}
+}
+
+/**
+ * Put a line of text in a comment or a string. A block comment in C-like
+ * code may be left open, to continue on the following lines.
+ */
+void CorpusGenerator::wrap_in_code(std::string& line)
+{
+	if (settings_.type == Options::csource) {
+		if (in_comment_ || rnd_.next(4) == 0) {
+			line.insert(0, in_comment_ ? " * " : "/* ");
+			in_comment_ = rnd_.next(2) == 0;
+			if (!in_comment_) line += " */";
+			return;
+		}
+		switch (rnd_.next(3)) {
+		case 0: line = "// " + line; break;
+		case 1: line = "\tputs(\"" + line + "\");"; break;
+		default: line = "\tn = count(p, 1); // " + line; break;
+		}
+	} else if (settings_.type == Options::script) {
+		switch (rnd_.next(4)) {
+		case 0: line = "# " + line; break;
+		case 1: line = "print(\"" + line + "\")"; break;
+		case 2: line = "echo '" + line + "'"; break;
+		default: line = "n = len(p)  # " + line; break;
+		}
+	}
+}
+
+/**
+ * Make a line of 1 to 2n-1 words, n being the mean. The first word is
+ * capitalized, and the line ends in a period or a comma.
+ */
+void CorpusGenerator::next_line(std::string& line)
+{
+	line.clear();
+
+	// No code inside a block comment
+	char const* markup = in_comment_ ? 0 : markup_line();
+	if (markup) {
+		line = markup;
+		return;
+	}
+
+	unsigned long n = 1 + rnd_.next(2 * settings_.line_words - 1);
+	for (unsigned long i = 0; i < n; ++i) {
+		if (i > 0) line += rnd_.next(12) ? " " : ", ";
+		append_word(line, pick_word(), i == 0);
+	}
+	line += rnd_.next(4) ? "." : ",";
+	wrap_in_code(line);
+}
+
+bool parse_corpus_type(char const* name, Options::FilterType* type)
+{
+	if (strcmp(name, "plain") == 0)
+		*type = Options::plain;
+	else if (strcmp(name, "tex") == 0)
+		*type = Options::tex;
+	else if (strcmp(name, "nroff") == 0)
+		*type = Options::nroff;
+	else if (strcmp(name, "sgml") == 0 || strcmp(name, "html") == 0)
+		*type = Options::sgml;
+	else if (strcmp(name, "markdown") == 0 || strcmp(name, "md") == 0)
+		*type = Options::markdown;
+	else if (strcmp(name, "csource") == 0 || strcmp(name, "c") == 0)
+		*type = Options::csource;
+	else if (strcmp(name, "script") == 0 || strcmp(name, "python") == 0 ||
+		 strcmp(name, "sh") == 0)
+		*type = Options::script;
+	else
+		return false;
+	return true;
+}
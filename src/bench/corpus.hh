@@ -0,0 +1,136 @@
+/* Copyright (C) Pauli Virtanen
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *********************************************************************************/
+
+/**
+ * @file corpus.hh
+ *
+ * Generating synthetic Finnish-like text for benchmarks and load tests.
+ */
+#ifndef CORPUS_HH_
+#define CORPUS_HH_
+
+#include <string>
+#include <vector>
+
+#include "options.hh"
+
+/**
+ * A deterministic pseudo-random number generator, so that the same seed
+ * gives the same text on every machine.
+ */
+class CorpusRandom
+{
+public:
+	/// Create a generator with the given seed
+	CorpusRandom(unsigned long seed) : state_(seed * 2654435761UL + 1) {}
+
+	/// Return a number in [0, n)
+	unsigned long next(unsigned long n)
+		{ return (unsigned long)(advance() >> 33) % n; }
+
+	/// Return a number in [0, 1)
+	double next_double()
+		{ return (advance() >> 11) * (1.0 / 9007199254740992.0); }
+
+private:
+	/// Step the 64-bit linear congruential generator
+	unsigned long long advance() {
+		state_ = state_ * 6364136223846793005ULL
+			+ 1442695040888963407ULL;
+		return state_;
+	}
+
+	/// The state of the generator
+	unsigned long long state_;
+};
+
+/**
+ * Generates lines of text made of Finnish-like words, optionally marked
+ * up for one of the filters.
+ *
+ * The words are strings of syllables: the more frequent a word is, the
+ * shorter it is. Their frequencies follow Zipf's law. A misspelled word
+ * has a q or an x in it, letters which do not occur in Finnish words.
+ * For source code, the lines of text are put in comments and strings
+ * between lines of code.
+ */
+class CorpusGenerator
+{
+public:
+	/// The parameters of the text
+	struct Settings
+	{
+		/// Set the defaults
+		Settings();
+
+		/// The seed of the random numbers
+		unsigned long seed;
+		/// The number of distinct words
+		unsigned long vocabulary;
+		/// The exponent of the Zipf distribution of the words
+		double zipf;
+		/// The fraction of the words misspelled
+		double misspelling_rate;
+		/// The mean number of words on a line
+		unsigned long line_words;
+		/// The fraction of the words with markup around them
+		double markup_density;
+		/// The kind of markup
+		Options::FilterType type;
+	};
+
+public:
+	/// Create a generator with the given settings
+	CorpusGenerator(Settings const& settings);
+
+	/// Replace line with the next line of text, without a line feed
+	void next_line(std::string& line);
+
+private:
+	/// Pick a word according to the frequencies
+	std::string const& pick_word();
+
+	/// Append a word to line, possibly misspelled and marked up
+	void append_word(std::string& line, std::string word,
+			 bool capitalize);
+
+	/// Return a line consisting of markup only, or 0
+	char const* markup_line();
+
+	/// Put a line of text in a comment or a string of source code
+	void wrap_in_code(std::string& line);
+
+	/// The settings
+	Settings settings_;
+
+	/// The random numbers
+	CorpusRandom rnd_;
+
+	/// The words, most frequent first
+	std::vector<std::string> words_;
+
+	/// The cumulative distribution of the words
+	std::vector<double> cumulative_;
+
+	/// Is the next line inside a block comment
+	bool in_comment_;
+};
+
+/// Parse a filter type name, as given to -T. Returns false if unknown.
+bool parse_corpus_type(char const* name, Options::FilterType* type);
+
+#endif // CORPUS_HH_
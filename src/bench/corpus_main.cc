@@ -0,0 +1,119 @@
+/* Copyright (C) Pauli Virtanen
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *********************************************************************************/
+
+/**
+ * @file corpus_main.cc
+ *
+ * tmispell-corpus: write synthetic Finnish-like text to standard output,
+ * for load testing the -l and -a modes. The same options and seed always
+ * give the same text.
+ */
+#include <string>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "corpus.hh"
+
+static void print_usage(char const* prog)
+{
+	fprintf(stderr,
+"Usage: %s [options]\n"
+"\n"
+" -T <type>  Markup: plain, tex, nroff, sgml, markdown, csource or\n"
+"            script (default plain).\n"
+" -s <seed>  Seed of the random numbers (default 1).\n"
+" -l <n>     Write n lines (default 10000).\n"
+" -b <size>  Write lines until size bytes are written, instead of -l.\n"
+"            The size may end in k, M or G.\n"
+" -V <n>     Number of distinct words (default 50000).\n"
+" -z <s>     Exponent of the Zipf distribution of words (default 1.0).\n"
+" -m <rate>  Fraction of words misspelled (default 0.03).\n"
+" -w <n>     Mean number of words on a line (default 10).\n"
+" -k <rate>  Fraction of words with markup (default 0.1).\n",
+		prog);
+}
+
+/** Parse a size with an optional k, M or G suffix */
+static unsigned long long parse_size(char const* str)
+{
+	char* end;
+	unsigned long long size = strtoull(str, &end, 10);
+	switch (*end) {
+	case 'k': case 'K': size <<= 10; break;
+	case 'm': case 'M': size <<= 20; break;
+	case 'g': case 'G': size <<= 30; break;
+	default: break;
+	}
+	return size;
+}
+
+int main(int argc, char* const* argv)
+{
+	CorpusGenerator::Settings settings;
+	unsigned long long lines = 10000;
+	unsigned long long bytes = 0;
+
+	int opt;
+	while ((opt = getopt(argc, argv, "T:s:l:b:V:z:m:w:k:h")) != -1) {
+		switch (opt) {
+		case 'T':
+			if (!parse_corpus_type(optarg, &settings.type)) {
+				fprintf(stderr, "Unknown type %s\n", optarg);
+				return 2;
+			}
+			break;
+		case 's': settings.seed = strtoul(optarg, 0, 10); break;
+		case 'l': lines = strtoull(optarg, 0, 10); bytes = 0; break;
+		case 'b': bytes = parse_size(optarg); break;
+		case 'V': settings.vocabulary = strtoul(optarg, 0, 10); break;
+		case 'z': settings.zipf = strtod(optarg, 0); break;
+		case 'm': settings.misspelling_rate = strtod(optarg, 0); break;
+		case 'w': settings.line_words = strtoul(optarg, 0, 10); break;
+		case 'k': settings.markup_density = strtod(optarg, 0); break;
+		default:
+			print_usage(argv[0]);
+			return opt == 'h' ? 0 : 2;
+		}
+	}
+
+	static char buffer[1 << 16];
+	setvbuf(stdout, buffer, _IOFBF, sizeof(buffer));
+
+	CorpusGenerator generator(settings);
+	std::string line;
+	unsigned long long written = 0;
+
+	for (unsigned long long n = 0; bytes ? written < bytes : n < lines;
+	     ++n) {
+		generator.next_line(line);
+		line += '\n';
+		if (fwrite(line.data(), 1, line.size(), stdout)
+		    != line.size()) {
+			perror("tmispell-corpus");
+			return 1;
+		}
+		written += line.size();
+	}
+
+	if (fflush(stdout) != 0) {
+		perror("tmispell-corpus");
+		return 1;
+	}
+	return 0;
+}
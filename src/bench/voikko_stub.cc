@@ -0,0 +1,133 @@
+/* Copyright (C) Pauli Virtanen
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *********************************************************************************/
+
+/**
+ * @file voikko_stub.cc
+ *
+ * A deterministic stand-in for the parts of the libvoikko API used by
+ * tmispell, so that the benchmarks need no dictionary and give the same
+ * results on every machine.
+ *
+ * A word is misspelled if it contains one of the letters q or x, which do
+ * not occur in Finnish words. The suggestions for a misspelled word are
+ * made by replacing the first such letter with each of a few common
+ * letters, and by dropping it.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include <libvoikko/voikko.h>
+
+/** The letters tried in place of a misspelled letter */
+static char const replacement_letters[] = "ksti";
+
+/**
+ * The number of handles given out and not yet terminated. The enchant
+ * provider initializes handles from several threads at once, so this is
+ * updated atomically.
+ */
+static int open_handles = 0;
+
+/** Find the first misspelled letter of a word */
+static char const* find_misspelling(char const* word)
+{
+	for (; *word; ++word) {
+		char c = *word;
+		if (c == 'q' || c == 'x' || c == 'Q' || c == 'X')
+			return word;
+	}
+	return 0;
+}
+
+const char* voikko_init(int* handle, const char* langcode, int cache_size)
+{
+	langcode=langcode;
+	cache_size=cache_size;
+	*handle = __sync_add_and_fetch(&open_handles, 1);
+	return 0;
+}
+
+int voikko_terminate(int handle)
+{
+	handle=handle;
+	__sync_sub_and_fetch(&open_handles, 1);
+	return 1;
+}
+
+int voikko_set_bool_option(int handle, int option, int value)
+{
+	handle=handle; option=option; value=value;
+	return 1;
+}
+
+int voikko_set_int_option(int handle, int option, int value)
+{
+	handle=handle; option=option; value=value;
+	return 1;
+}
+
+int voikko_set_string_option(int handle, int option, const char* value)
+{
+	handle=handle; option=option; value=value;
+	return 1;
+}
+
+int voikko_spell_cstr(int handle, const char* word)
+{
+	handle=handle;
+	return find_misspelling(word) ? VOIKKO_SPELL_FAILED : VOIKKO_SPELL_OK;
+}
+
+char** voikko_suggest_cstr(int handle, const char* word)
+{
+	handle=handle;
+
+	char const* bad = find_misspelling(word);
+	if (bad == 0) return 0;
+
+	size_t len = strlen(word);
+	size_t pos = bad - word;
+	size_t nletters = sizeof(replacement_letters) - 1;
+
+	char** suggestions = (char**)malloc((nletters + 2) * sizeof(char*));
+	size_t n = 0;
+
+	for (size_t i = 0; i < nletters; ++i) {
+		char* s = (char*)malloc(len + 1);
+		memcpy(s, word, len + 1);
+		s[pos] = replacement_letters[i];
+		suggestions[n++] = s;
+	}
+
+	if (len > 1) {
+		char* s = (char*)malloc(len);
+		memcpy(s, word, pos);
+		memcpy(s + pos, word + pos + 1, len - pos);
+		suggestions[n++] = s;
+	}
+
+	suggestions[n] = 0;
+	return suggestions;
+}
+
+void voikko_free_suggest_cstr(char** suggest_result)
+{
+	if (suggest_result == 0) return;
+	for (char** s = suggest_result; *s; ++s)
+		free(*s);
+	free(suggest_result);
+}
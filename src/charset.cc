@@ -33,6 +33,7 @@
 #include "i18n.hh"
 #include "common.hh"
 #include "charset.hh"
+#include "statistics.hh"
 
 /**
  * Private implementation for the character set converter.
@@ -50,6 +51,9 @@ public:
 	/// Convert internal UTF-8 to external encoding
 	std::string to(Glib::ustring str);
 
+	/// Is the external encoding UTF-8
+	bool is_utf8() const { return utf8_; }
+
 private:
 	/// The name of the character set
 	std::string cset_;
@@ -57,6 +61,8 @@ private:
 	Glib::IConv* to_;
 	/// The iconv handle to convert external encoding to internal UTF-8
 	Glib::IConv* from_;
+	/// Is the external encoding UTF-8
+	bool utf8_;
 };
 
 /**
@@ -64,8 +70,15 @@ private:
  * @param cset	The character set name, as recognized by iconv.
  */
 CharsetConverterPimpl::CharsetConverterPimpl(char const* cset)
-	: cset_(cset)
+	: cset_(cset), utf8_(false)
 {
+	// Recognize the usual spellings: UTF-8, utf8, ...
+	std::string name;
+	for (char const* p = cset; *p; ++p) {
+		if (*p != '-' && *p != '_') name += g_ascii_tolower(*p);
+	}
+	utf8_ = (name == "utf8");
+
 	try {
 		to_ = new Glib::IConv(cset, "UTF-8");
 		from_ = new Glib::IConv("UTF-8", cset);
@@ -145,6 +158,7 @@ CharsetConverter::~CharsetConverter()
  */
 Glib::ustring CharsetConverter::from(std::string str)
 {
+	Statistics::Timer timer(Statistics::convert_from);
 	return pimpl_->from(str);
 }
 
@@ -154,9 +168,32 @@ Glib::ustring CharsetConverter::from(std::string str)
  */
 std::string CharsetConverter::to(Glib::ustring wstr)
 {
+	Statistics::Timer timer(Statistics::convert_to);
 	return pimpl_->to(wstr);
 }
 
+/**
+ * Is the external encoding UTF-8. Then text that is valid UTF-8 can be
+ * used as it is, without converting it.
+ */
+bool CharsetConverter::is_utf8() const
+{
+	return pimpl_->is_utf8();
+}
+
+/**
+ * Return the length in bytes of the UTF-8 text [begin, end) in the external
+ * encoding, such as to turn an offset in converted text into one in the
+ * text as it was read.
+ */
+std::string::size_type CharsetConverter::external_length(
+	Glib::ustring::const_iterator begin,
+	Glib::ustring::const_iterator end)
+{
+	if (is_utf8()) return end.base() - begin.base();
+	return to(Glib::ustring(std::string(begin.base(), end.base()))).size();
+}
+
 /** The character set converter for the default locale */
 CharsetConverter* CharsetConverter::locale_ = 0;
 
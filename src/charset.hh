@@ -49,6 +49,14 @@ public:
 	/// Convert from internal UTF-8 to external encoding
 	std::string to(Glib::ustring wstr);
 
+	/// Is the external encoding UTF-8, so that no conversion is needed
+	bool is_utf8() const;
+
+	/// The length in bytes of UTF-8 text in the external encoding
+	std::string::size_type external_length(
+		Glib::ustring::const_iterator begin,
+		Glib::ustring::const_iterator end);
+
 	/// Get the converter corresponding to the default locale
 	static CharsetConverter& locale();
 	
@@ -37,4 +37,31 @@ void tolower(Glib::ustring& str);
 /// Convert the given string to uppercase in-place.
 void toupper(Glib::ustring& str);
 
+/**
+ * Owns an object allocated with new, and deletes it when going out of
+ * scope or when given another one.
+ */
+template <class T>
+class ScopedPtr
+{
+public:
+	explicit ScopedPtr(T* p = 0) : p_(p) {}
+	~ScopedPtr() { delete p_; }
+
+	/// The object owned, or 0
+	T* get() const { return p_; }
+	T* operator->() const { return p_; }
+	T& operator*() const { return *p_; }
+
+	/// Delete the object owned, and own p instead
+	void reset(T* p = 0) { if (p != p_) { delete p_; p_ = p; } }
+
+private:
+	ScopedPtr(ScopedPtr const&);
+	ScopedPtr& operator=(ScopedPtr const&);
+
+	/// The object owned
+	T* p_;
+};
+
 #endif
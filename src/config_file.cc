@@ -22,13 +22,20 @@
  * Parsing the configuration file.
  */
 #include <iostream>
-#include <fstream>
-#include <sstream>
 #include <string>
 #include <map>
 
 #include <cctype>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
 
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "config.hh"
 #include "i18n.hh"
 #include "common.hh"
 #include "regexp.hh"
@@ -37,8 +44,6 @@
 #include "config_file.hh"
 
 using std::istream;
-using std::ifstream;
-using std::ostringstream;
 using std::map;
 using std::string;
 
@@ -66,8 +71,8 @@ using std::string;
 class ConfigFileIterator
 {
 public:
-	/// Open a file for reading
-	ConfigFileIterator(string const& file_name);
+	/// Read a file, storing its status to st
+	ConfigFileIterator(string const& file_name, struct stat* st);
 
 	/// Get the next quoted string, skipping no-linefeed whitespace first
 	string get_next_quoted_string();
@@ -187,24 +192,26 @@ void ConfigFileIterator::skip_comments_and_whitespace()
 }
 
 /**
- * Read the given file to memory for parsing.
+ * Read the given file to memory for parsing. The status of the file is
+ * taken from the same descriptor, so that it describes the version read.
  */
-ConfigFileIterator::ConfigFileIterator(string const& file_name)
+ConfigFileIterator::ConfigFileIterator(string const& file_name,
+				       struct stat* st)
 {
-	ifstream in(file_name.c_str());
-	ostringstream out;
+	int fd = open(file_name.c_str(), O_RDONLY);
 
-	if (!in) {
+	if (fd < 0 || fstat(fd, st) != 0) {
+		if (fd >= 0) close(fd);
 		throw Error(_("Unable to open configuration file %s"),
 			    file_name.c_str());
 	}
 
 	char buf[1024];
-	int readen;
-	while ((readen = in.rdbuf()->sgetn(buf, 1024)) > 0)
-		out.write(buf, readen);
+	ssize_t readen;
+	while ((readen = read(fd, buf, sizeof(buf))) > 0)
+		buffer_.append(buf, readen);
+	close(fd);
 
-	buffer_ = out.str();
 	line_ = 1;
 	p_ = buffer_.begin();
 }
@@ -290,11 +297,26 @@ static bool handle_option_lines(ConfigFileIterator& i,
 }
 
 /**
- * Read and parse configuration file.
+ * Read configuration file, from the cache if it is up to date, and parse
+ * it otherwise.
  */
 ConfigFile::ConfigFile(string const& file_name)
 {
-	ConfigFileIterator i(file_name);
+	if (load_cache(file_name))
+		return;
+
+	struct stat st;
+	parse(file_name, &st);
+	save_cache(file_name, st);
+}
+
+/**
+ * Read and parse configuration file, storing the status of the version
+ * read to st.
+ */
+void ConfigFile::parse(string const& file_name, struct stat* st)
+{
+	ConfigFileIterator i(file_name, st);
 
 	i.skip_comments_and_whitespace();
 	while (i) {
@@ -317,6 +339,335 @@ ConfigFile::ConfigFile(string const& file_name)
 /** @} */
 
 
+/****************************************************************************/
+/** @name Binary cache of the parsed configuration file
+ **
+ ** The parsed configuration is stored in
+ ** $XDG_CACHE_HOME/tmispell/config-<hash of path>.cache, with the
+ ** character lists already expanded. The cache is valid as long as the
+ ** device, inode, size and modification time of the configuration file
+ ** match the ones recorded in it. The cache is in native byte order, as
+ ** it is never shared between machines.
+ ** @{
+ **/
+
+/// The magic string in the beginning of the cache file
+static char const config_cache_magic[8] = { 'T','M','I','S','P','C','F','G' };
+
+/// The version of the cache file format
+static unsigned int const config_cache_version = 1;
+
+/**
+ * Return the name of the cache file for the given configuration file,
+ * or an empty string if there is no place for it.
+ */
+static string get_config_cache_name(string const& file_name)
+{
+	string dir;
+	char const* env = getenv("XDG_CACHE_HOME");
+	if (env && *env) {
+		dir = env;
+	} else if ((env = getenv("HOME")) && *env) {
+		dir = string(env) + "/.cache";
+	} else {
+		return string();
+	}
+
+	// FNV-1a hash of the path distinguishes configuration files
+	unsigned long long hash = 14695981039346656037ULL;
+	string::const_iterator i;
+	for (i = file_name.begin(); i != file_name.end(); ++i) {
+		hash ^= (unsigned char)*i;
+		hash *= 1099511628211ULL;
+	}
+
+	return dir + ssprintf("/tmispell/config-%016llx.cache", hash);
+}
+
+/**
+ * The identity of a configuration file version, as recorded in the cache.
+ */
+struct ConfigStamp
+{
+	/// Stat the given file. Return false if that fails.
+	bool read(string const& file_name)
+		{
+			struct stat st;
+			if (stat(file_name.c_str(), &st) != 0) return false;
+			set(st);
+			return true;
+		}
+
+	/// Take the identity from the status of a file
+	void set(struct stat const& st)
+		{
+			dev = st.st_dev;
+			ino = st.st_ino;
+			size = st.st_size;
+			mtime = st.st_mtime;
+#ifdef HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC
+			mtime_nsec = st.st_mtim.tv_nsec;
+#else
+			mtime_nsec = 0;
+#endif
+		}
+
+	unsigned long long dev, ino, size, mtime, mtime_nsec;
+};
+
+/**
+ * Serialize data to a cache buffer.
+ */
+class CacheWriter
+{
+public:
+	void u32(unsigned int v)
+		{ buffer_.append((char const*)&v, sizeof(v)); }
+	void u64(unsigned long long v)
+		{ buffer_.append((char const*)&v, sizeof(v)); }
+	void str(string const& s)
+		{ u32(s.size()); buffer_.append(s); }
+	void chars(std::vector<gunichar> const& v)
+		{
+			u32(v.size());
+			std::vector<gunichar>::const_iterator i;
+			for (i = v.begin(); i != v.end(); ++i) u32(*i);
+		}
+	void stamp(ConfigStamp const& st)
+		{
+			u64(st.dev); u64(st.ino); u64(st.size);
+			u64(st.mtime); u64(st.mtime_nsec);
+		}
+
+	string const& buffer() const { return buffer_; }
+
+private:
+	string buffer_;
+};
+
+/**
+ * Deserialize data from a cache buffer. Reading past the end of the
+ * buffer just marks the reader failed.
+ */
+class CacheReader
+{
+public:
+	CacheReader(char const* begin, char const* end)
+		: p_(begin), end_(end), ok_(true) {}
+
+	unsigned int u32()
+		{ unsigned int v = 0; get(&v, sizeof(v)); return v; }
+	unsigned long long u64()
+		{ unsigned long long v = 0; get(&v, sizeof(v)); return v; }
+	string str()
+		{
+			unsigned int n = u32();
+			if (!ok_ || (unsigned long)(end_ - p_) < n) {
+				ok_ = false;
+				return string();
+			}
+			string s(p_, n);
+			p_ += n;
+			return s;
+		}
+	void chars(std::vector<gunichar>& v)
+		{
+			unsigned int n = u32();
+			if (!ok_ || (unsigned long)(end_ - p_) / 4 < n) {
+				ok_ = false;
+				return;
+			}
+			v.resize(n);
+			for (unsigned int i = 0; i < n; ++i) v[i] = u32();
+		}
+	bool stamp_matches(ConfigStamp const& st)
+		{
+			return u64() == st.dev && u64() == st.ino &&
+				u64() == st.size && u64() == st.mtime &&
+				u64() == st.mtime_nsec && ok_;
+		}
+
+	/// Is there still unread data
+	bool at_end() const { return p_ == end_; }
+
+	/// Has everything read so far been valid
+	bool ok() const { return ok_; }
+
+private:
+	void get(void* out, unsigned int n)
+		{
+			if (!ok_ || (unsigned long)(end_ - p_) < n) {
+				ok_ = false;
+				return;
+			}
+			memcpy(out, p_, n);
+			p_ += n;
+		}
+
+	char const* p_;
+	char const* end_;
+	bool ok_;
+};
+
+/**
+ * Read the whole given file to a string with a single read.
+ * @return Whether the file could be read.
+ */
+static bool read_whole_file(string const& file_name, string* data)
+{
+	int fd = open(file_name.c_str(), O_RDONLY);
+	if (fd < 0) return false;
+
+	struct stat st;
+	if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+		close(fd);
+		return false;
+	}
+
+	data->resize(st.st_size);
+	size_t done = 0;
+	while (done < data->size()) {
+		ssize_t n = read(fd, &(*data)[done], data->size() - done);
+		if (n <= 0) break;
+		done += n;
+	}
+	close(fd);
+	return done == data->size();
+}
+
+/**
+ * Load the options and spell checker entries from the cache, if the cache
+ * is up to date with the configuration file.
+ * @return Whether the configuration was loaded.
+ */
+bool ConfigFile::load_cache(string const& file_name)
+{
+	string cache_name = get_config_cache_name(file_name);
+	ConfigStamp stamp;
+	string data;
+
+	if (cache_name.empty() || !stamp.read(file_name) ||
+	    !read_whole_file(cache_name, &data) ||
+	    data.size() < sizeof(config_cache_magic) ||
+	    memcmp(data.data(), config_cache_magic,
+		   sizeof(config_cache_magic)) != 0)
+		return false;
+
+	CacheReader r(data.data() + sizeof(config_cache_magic),
+		      data.data() + data.size());
+
+	if (r.u32() != config_cache_version || !r.stamp_matches(stamp) ||
+	    r.str() != file_name)
+		return false;
+
+	OptionMap options;
+	unsigned int n_options = r.u32();
+	for (unsigned int k = 0; r.ok() && k < n_options; ++k) {
+		string key = r.str();
+		options[key] = r.str();
+	}
+
+	SpellcheckerMap entries;
+	unsigned int n_entries = r.u32();
+	for (unsigned int k = 0; r.ok() && k < n_entries; ++k) {
+		string id = r.str();
+		string library = r.str();
+		string dictionary = r.str();
+		string encoding = r.str();
+		string lc_ctype = r.str();
+		std::vector<gunichar> word_chars, boundary_chars;
+		r.chars(word_chars);
+		r.chars(boundary_chars);
+
+		entries.insert(
+			SpellcheckerMap::value_type(
+				id,
+				SpellcheckerEntry(library,
+						  dictionary,
+						  encoding,
+						  lc_ctype,
+						  word_chars,
+						  boundary_chars)));
+	}
+
+	if (!r.ok() || !r.at_end())
+		return false;
+
+	options_.swap(options);
+	entries_.swap(entries);
+	return true;
+}
+
+/**
+ * Store the options and spell checker entries to the cache, stamped with
+ * the status st of the configuration file they were parsed from. Failing
+ * to do so is not an error: the configuration file is just parsed again
+ * next time.
+ */
+void ConfigFile::save_cache(string const& file_name,
+			    struct stat const& st) const
+{
+	string cache_name = get_config_cache_name(file_name);
+	ConfigStamp stamp;
+
+	if (cache_name.empty())
+		return;
+	stamp.set(st);
+
+	CacheWriter w;
+	w.u32(config_cache_version);
+	w.stamp(stamp);
+	w.str(file_name);
+
+	w.u32(options_.size());
+	OptionMap::const_iterator o;
+	for (o = options_.begin(); o != options_.end(); ++o) {
+		w.str(o->first);
+		w.str(o->second);
+	}
+
+	w.u32(entries_.size());
+	SpellcheckerMap::const_iterator e;
+	for (e = entries_.begin(); e != entries_.end(); ++e) {
+		w.str(e->first);
+		w.str(e->second.get_library());
+		w.str(e->second.get_dictionary());
+		w.str(e->second.get_encoding());
+		w.str(e->second.get_lc_ctype());
+		w.chars(e->second.get_word_chars());
+		w.chars(e->second.get_boundary_chars());
+	}
+
+	// Create the cache directory and its parent, if missing
+	string::size_type slash = cache_name.rfind('/');
+	string dir = cache_name.substr(0, slash);
+	mkdir(dir.substr(0, dir.rfind('/')).c_str(), 0700);
+	mkdir(dir.c_str(), 0700);
+
+	// Write to a temporary file, and move it in place atomically
+	string tmp_name = cache_name + ssprintf(".%ld", (long)getpid());
+	int fd = open(tmp_name.c_str(), O_WRONLY|O_CREAT|O_TRUNC, 0600);
+	if (fd < 0) return;
+
+	string data(config_cache_magic, sizeof(config_cache_magic));
+	data += w.buffer();
+
+	size_t done = 0;
+	while (done < data.size()) {
+		ssize_t n = write(fd, data.data() + done, data.size() - done);
+		if (n <= 0) break;
+		done += n;
+	}
+
+	if (close(fd) != 0 || done != data.size() ||
+	    rename(tmp_name.c_str(), cache_name.c_str()) != 0) {
+		unlink(tmp_name.c_str());
+	}
+}
+
+/** @} */
+
+
 /** Create a new spell checker entry */
 SpellcheckerEntry::SpellcheckerEntry(std::string library,
 				     std::string dictionary,
@@ -337,6 +688,22 @@ SpellcheckerEntry::SpellcheckerEntry(std::string library,
 			       boundary_chars.end());
 }
 
+/** Create a new spell checker entry with expanded character lists */
+SpellcheckerEntry::SpellcheckerEntry(std::string library,
+				     std::string dictionary,
+				     std::string encoding,
+				     std::string lc_ctype,
+				     std::vector<gunichar> const& word_chars,
+				     std::vector<gunichar> const& boundary_chars)
+	: library_(library),
+	  dictionary_(dictionary),
+	  encoding_(encoding),
+	  lc_ctype_(lc_ctype),
+	  word_chars_(word_chars),
+	  boundary_chars_(boundary_chars)
+{
+}
+
 /**
  * Case insensitive string lexical StrictWeakOrdering.
  */
@@ -44,6 +44,14 @@ public:
 			  std::string word_chars,
 			  std::string boundary_chars);
 
+	/// Create an entry with already expanded character lists
+	SpellcheckerEntry(std::string library,
+			  std::string dictionary,
+			  std::string encoding,
+			  std::string lc_ctype,
+			  std::vector<gunichar> const& word_chars,
+			  std::vector<gunichar> const& boundary_chars);
+
 	/// Return the library file name
 	std::string const& get_library() const
 		{ return library_; }
@@ -111,6 +119,17 @@ public:
 	/// Mapping from option name to the value of option
 	typedef std::map<std::string, std::string, NocaseCmp> OptionMap;
 
+private:
+	/// Parse the given configuration file, storing its status to st
+	void parse(std::string const& file_name, struct stat* st);
+
+	/// Load a parsed configuration from the cache, if it is up to date
+	bool load_cache(std::string const& file_name);
+
+	/// Store the parsed configuration to the cache, stamped with st
+	void save_cache(std::string const& file_name,
+			struct stat const& st) const;
+
 private:
 	/// The mapping from option identifiers to option content
 	OptionMap options_;
@@ -36,10 +36,13 @@
 #include <map>
 #include <set>
 
+#include <string.h>
+
 #include "glibmm/ustring.h"
 #include "glibmm/unicode.h"
 #include "regexp.hh"
 #include "filter.hh"
+#include "html_entities.hh"
 #include "options.hh"
 
 /****************************************************************************/
@@ -62,7 +65,8 @@ static bool is_string_at(Glib::ustring::const_iterator beg,
 }
 
 /**
- * Plain filter. Just splits words.
+ * Plain filter. Splits words, skipping URLs, e-mail addresses, paths and
+ * hexadecimal numbers such as hashes and UUIDs.
  * FIXME: Relies on the fact that the locale is set properly.
  */
 class PlainFilter : public Filter
@@ -73,20 +77,34 @@ public:
 	virtual ~PlainFilter() {}
 	
 	/// Return to a specified position in a line.
-	virtual void reset(Glib::ustring::const_iterator pos){ pos_ = pos; }
+	virtual void reset(Glib::ustring::const_iterator pos)
+		{ pos_ = pos; token_end_ = pos; }
 
 	/// Set a new line.
 	virtual void set_line(Glib::ustring const* line)
 		{
 			Filter::set_line(line);
 			pos_ = line_->begin();
+			token_end_ = pos_;
 		}
 
 	/// Get next whole word from the line.
 	virtual bool get_next_word(Glib::ustring::const_iterator* found_begin,
 				   Glib::ustring::const_iterator* found_end);
 
+	/// Save the state. Plain text has none but the position: the end
+	/// of the last token looked at is only a cache, cleared by reset.
+	virtual Filter::Checkpoint* save_checkpoint() const
+		{ return new Checkpoint; }
+
 protected:
+	/** The state of a filter with no state */
+	struct Checkpoint : public Filter::Checkpoint
+	{
+		virtual bool same_as(Filter::Checkpoint const&) const
+			{ return true; }
+	};
+
 	/** Is the given character a part of a word? */
 	bool is_word_char(gunichar c) const
 		{ return Glib::Unicode::isalpha(c) ||
@@ -116,16 +134,33 @@ protected:
 		{ return (is_pos_valid() && *pos_ == ch); }
 
 	/// Is there a str at current pos_?
-	bool is_at(Glib::ustring const& str)
+	bool is_at(Glib::ustring const& str) const
 		{ return is_string_at(pos_, line_->end(), str); }
 	
-	/// Is there a str at current pos_?
-	bool is_at(char const* str)
-		{ return is_at(Glib::ustring(str)); }
+	/// Is there an ASCII str at current pos_?
+	bool is_at(char const* str) const
+		{
+			Glib::ustring::const_iterator p = pos_;
+			for (; *str != '\0'; ++str, ++p) {
+				if (p == line_->end() ||
+				    *p != (unsigned char)*str) return false;
+			}
+			return true;
+		}
 	
 	/** Skip word characters and boundary characters inside words */
 	void skip_over_word();
 
+	/** Get the word at the current position */
+	bool get_word(Glib::ustring::const_iterator* found_begin,
+		      Glib::ustring::const_iterator* found_end);
+
+	/**
+	 * Skip the token around the current position, if it is a URL, an
+	 * e-mail address, a path or a hexadecimal number.
+	 */
+	bool skip_token();
+
 	/** Skip whitespace */
 	void skip_whitespace()
 		{ while (is_pos_valid() && Glib::Unicode::isspace(*pos_)) ++pos_; }
@@ -146,6 +181,15 @@ protected:
 	void skip_n(int n)
 		{ for (; is_pos_valid() && n > 0; --n) ++pos_; }
 
+	/** Return the length of the run of ch at p */
+	unsigned int run_length(Glib::ustring::const_iterator p,
+				gunichar ch) const
+		{
+			unsigned int n = 0;
+			for (; p != line_->end() && *p == ch; ++p) ++n;
+			return n;
+		}
+
 	/** The current position in the current line */
 	Glib::ustring::const_iterator pos_;
 
@@ -173,6 +217,9 @@ private:
 
 	/** Lookup table of boundary characters */
 	std::set<gunichar> boundary_characters_;
+
+	/** The end of the last token looked at by skip_token */
+	Glib::ustring::const_iterator token_end_;
 };
 
 PlainFilter::PlainFilter(Options const& options) 
@@ -200,10 +247,156 @@ void PlainFilter::skip_over_word()
 	}
 }
 
-bool PlainFilter::get_next_word(Glib::ustring::const_iterator* found_begin,
-				Glib::ustring::const_iterator* found_end)
+/** Is c an ASCII letter or digit? */
+static inline bool is_ascii_alnum(char c)
+{
+	return (unsigned char)c < 0x80 && isalnum(c);
+}
+
+/** Is [p, end) at least as long as str, and does it start with it? */
+static inline bool starts_with(std::string::const_iterator p,
+			       std::string::const_iterator end,
+			       char const* str)
+{
+	for (; *str != '\0'; ++p, ++str) {
+		if (p == end || *p != *str) return false;
+	}
+	return true;
+}
+
+/**
+ * Is the token a URL, an e-mail address, a path or a hexadecimal number?
+ *
+ * URLs have a scheme and // or start with mailto: or www. E-mail
+ * addresses have something before the @ and a dot in the domain. Paths
+ * start with /, ~/, ./ or ../, have two slashes, or have a file name
+ * with a suffix after a slash; and/or is not a path. Hexadecimal numbers
+ * start with 0x, or have at least six hexadecimal digits, some of them
+ * letters and some of them digits, and possibly dashes as UUIDs do.
+ */
+static bool is_special_token(std::string::const_iterator begin,
+			     std::string::const_iterator end)
+{
+	std::string::const_iterator p;
+
+	// URLs
+	p = begin;
+	if (p != end && (unsigned char)*p < 0x80 && isalpha(*p)) {
+		while (p != end && (is_ascii_alnum(*p) || *p == '+' ||
+				    *p == '-' || *p == '.')) ++p;
+		if (starts_with(p, end, "://")) return true;
+	}
+	if (starts_with(begin, end, "mailto:") ||
+	    starts_with(begin, end, "www.")) return true;
+
+	// E-mail addresses
+	p = std::find(begin, end, '@');
+	if (p != begin && p != end) {
+		std::string::const_iterator dot = std::find(p + 1, end, '.');
+		if (dot != end && dot != p + 1 && dot + 1 != end) return true;
+	}
+
+	// Paths
+	if ((*begin == '/' && end - begin > 1 && is_ascii_alnum(begin[1])) ||
+	    starts_with(begin, end, "~/") || starts_with(begin, end, "./") ||
+	    starts_with(begin, end, "../")) return true;
+	unsigned int slashes = std::count(begin, end, '/');
+	if (slashes >= 2) return true;
+	if (slashes == 1) {
+		p = std::find(begin, end, '/');
+		if (std::find(p, end, '.') != end) return true;
+	}
+
+	// Hexadecimal numbers, hashes and UUIDs
+	if (starts_with(begin, end, "0x") || starts_with(begin, end, "0X")) {
+		p = begin + 2;
+		while (p != end && (unsigned char)*p < 0x80 && isxdigit(*p))
+			++p;
+		if (p == end && end - begin > 2) return true;
+	}
+	unsigned int hex_digits = 0;
+	bool digit = false, letter = false;
+	for (p = begin; p != end; ++p) {
+		if ((unsigned char)*p >= 0x80) return false;
+		if (isdigit(*p)) {
+			digit = true;
+		} else if (isxdigit(*p)) {
+			letter = true;
+		} else if (*p != '-') {
+			return false;
+		}
+		if (*p != '-') ++hex_digits;
+	}
+	return digit && letter && hex_digits >= 6;
+}
+
+/**
+ * Does the byte end a token? Tokens end at ASCII whitespace and at quotes,
+ * brackets and the like, which also delimit the markup of the filters
+ * deriving from this one.
+ */
+static inline bool is_token_end(char c)
+{
+	switch (c) {
+	case ' ': case '\t': case '\n': case '\r': case '\f': case '\v':
+	case '"': case '\'': case '`': case '<': case '>': case '(': case ')':
+	case '[': case ']': case '{': case '}': case '\\': case '|': case '*':
+	case ',': case ';': case '\0':
+		return true;
+	default:
+		return false;
+	}
+}
+
+/**
+ * Is the byte one of those that every URL, e-mail address, path or
+ * hexadecimal number but a www. address has?
+ */
+static inline bool is_token_mark(char c)
+{
+	return c == ':' || c == '/' || c == '@' || (c >= '0' && c <= '9');
+}
+
+/**
+ * If the current position is in a URL, an e-mail address, a path or a
+ * hexadecimal number, skip to its end and return true. The punctuation
+ * at the end of a token is not a part of it. Each token is scanned once,
+ * bytewise, and only tokens with a telltale byte are looked at closer.
+ */
+bool PlainFilter::skip_token()
+{
+	if (pos_.base() < token_end_.base()) return false;
+
+	std::string const& raw = line_->raw();
+	std::string::const_iterator pos = pos_.base();
+	bool marked = false;
+
+	std::string::const_iterator begin = pos;
+	while (begin != raw.begin() && !is_token_end(begin[-1])) {
+		--begin;
+		marked = marked || is_token_mark(*begin);
+	}
+
+	std::string::const_iterator end = pos;
+	while (end != raw.end() && !is_token_end(*end)) {
+		marked = marked || is_token_mark(*end);
+		++end;
+	}
+	token_end_ = Glib::ustring::const_iterator(end);
+
+	while (end != begin && (end[-1] == '.' || end[-1] == ':' ||
+				end[-1] == '!' || end[-1] == '?')) --end;
+
+	if (end <= pos || !(marked || starts_with(begin, end, "www.")) ||
+	    !is_special_token(begin, end))
+		return false;
+	pos_ = Glib::ustring::const_iterator(end);
+	return true;
+}
+
+bool PlainFilter::get_word(Glib::ustring::const_iterator* found_begin,
+			   Glib::ustring::const_iterator* found_end)
 {
-	skip_non_word_characters();
 	*found_begin = pos_;
 	skip_over_word();
 	*found_end = pos_;
@@ -215,6 +408,14 @@ bool PlainFilter::get_next_word(Glib::ustring::const_iterator* found_begin,
 	}
 }
 
+bool PlainFilter::get_next_word(Glib::ustring::const_iterator* found_begin,
+				Glib::ustring::const_iterator* found_end)
+{
+	skip_non_word_characters();
+	while (is_pos_valid() && skip_token()) skip_non_word_characters();
+	return get_word(found_begin, found_end);
+}
+
 /** @} */
 
 
@@ -285,6 +486,12 @@ public:
 	virtual bool get_next_word(Glib::ustring::const_iterator* found_begin,
 				   Glib::ustring::const_iterator* found_end);
 
+	/// Save the comment flag and the command stack
+	virtual Filter::Checkpoint* save_checkpoint() const;
+
+	/// Return to a saved comment flag and command stack
+	virtual void restore_checkpoint(Filter::Checkpoint const& checkpoint);
+
 private:
 	/// Notify the parser that a line has changed
 	void parse_line_change();
@@ -348,6 +555,18 @@ private:
 		/// Are there no more known parameters
 		bool finished() { return cur_ == end_; }
 
+		/// Is this the same command in the same state
+		bool operator==(Command const& other) const
+			{
+				// Commands of the same name have the same
+				// parameter list
+				return name_ == other.name_ &&
+					is_environment_ ==
+					other.is_environment_ &&
+					waiting_param_ == other.waiting_param_ &&
+					cur_ == other.cur_ && end_ == other.end_;
+			}
+
 		/// Is a parameter optional
 		static bool is_opt(ParamType type) {
 			return (type == opt_nocheck || type == opt_check);
@@ -413,6 +632,21 @@ private:
 	/// Pop an environment from stack
 	void pop_env(Glib::ustring name);
 
+	/// The state of the filter
+	struct Checkpoint : public Filter::Checkpoint
+	{
+		virtual bool same_as(Filter::Checkpoint const& other) const
+			{
+				Checkpoint const& o =
+					static_cast<Checkpoint const&>(other);
+				return in_comment == o.in_comment &&
+					stack == o.stack;
+			}
+
+		bool in_comment;
+		std::deque<Command> stack;
+	};
+
 	/// Are we currently in comment?
 	bool in_comment_;
 
@@ -424,6 +658,13 @@ private:
 
 	/// Environments to skip
 	std::map<Glib::ustring, bool> skip_environment_;
+
+	/// Extracts a command name after a backslash. Each filter has its
+	/// own, as filters may be used in several threads at once.
+	RegExp cmdre_;
+
+	/// Extracts an environment name from a \begin or \end
+	RegExp envre_;
 };
 
 /// A dummy command: to return when nothing else found
@@ -455,7 +696,11 @@ static void load_ws_separated_string_to_map(Glib::ustring const& str,
  * Also init underlying PlainFilter.
  */
 TeXFilter::TeXFilter(Options const& options)
-	: PlainFilter(options)
+	: PlainFilter(options),
+	  // Note that this regexp strips the possible * from the end of a
+	  // command, so only the base entry needs to exist in tex_commands.
+	  cmdre_("^\\\\([@a-zA-Z0-9]+)\\*?", RegExp::EXTENDED),
+	  envre_("^\\{([a-zA-Z0-9]+)\\*?\\}", RegExp::EXTENDED)
 {
 	cmd_params_.clear();
 	skip_environment_.clear();
@@ -535,6 +780,21 @@ void TeXFilter::parse_line_change()
 	in_comment_ = false;
 }
 
+Filter::Checkpoint* TeXFilter::save_checkpoint() const
+{
+	Checkpoint* checkpoint = new Checkpoint;
+	checkpoint->in_comment = in_comment_;
+	checkpoint->stack = stack_;
+	return checkpoint;
+}
+
+void TeXFilter::restore_checkpoint(Filter::Checkpoint const& checkpoint)
+{
+	Checkpoint const& c = static_cast<Checkpoint const&>(checkpoint);
+	in_comment_ = c.in_comment;
+	stack_ = c.stack;
+}
+
 /**
  * Return whether we are in an environment (e.g. math) that should be skipped
  * wholly.
@@ -579,21 +839,15 @@ bool TeXFilter::get_next_word(Glib::ustring::const_iterator* found_begin,
 		if (*pos_ == '\\') {
 			discard_waiting_commands();
 
-			// Note that this regexp strips the possible *
-			// from the end of a command, so only the base
-			// entry needs to exist in tex_commands.
-			static RegExp cmdre("^\\\\([@a-zA-Z0-9]+)\\*?",
-					    RegExp::EXTENDED);
-			
-			if (cmdre.match(*line_, pos_) &&
-			    cmdre.begin(1) != cmdre.end(1)) {
-				// We assume cmdre contains chars in the
+			if (cmdre_.match(*line_, pos_) &&
+			    cmdre_.begin(1) != cmdre_.end(1)) {
+				// We assume cmdre_ contains chars in the
 				// ASCII subset of UTF-8!
-				std::advance(pos_, cmdre.end(0));
+				std::advance(pos_, cmdre_.end(0));
 
 				// A beginning of a command: extract name
 				// and parameter spec
-				Glib::ustring name(cmdre.sub(*line_, 1));
+				Glib::ustring name(cmdre_.sub(*line_, 1));
 				Params const* params = lookup_cmd_params(name);
 				
 				// Environments receive special handling
@@ -657,8 +911,8 @@ bool TeXFilter::get_next_word(Glib::ustring::const_iterator* found_begin,
 				    (top().finished() || // check unknown parms
 				     *top().cur_ == check ||
 				     *top().cur_ == opt_check)) {
-					return PlainFilter::get_next_word(
-						found_begin, found_end);
+					return get_word(found_begin,
+							found_end);
 				} else {
 					skip_over_word();
 				}
@@ -747,21 +1001,18 @@ void TeXFilter::pop_env(Glib::ustring name)
 	}
 }
 
-/// A regexp to extract a name for an environment from a \begin or \end.
-static RegExp tex_envre("^\\{([a-zA-Z0-9]+)\\*?\\}", RegExp::EXTENDED);
-
 /**
  * Handle the beginning of an environment: extract name and push to stack.
  * This should be called after \begin encountered.
  */
 void TeXFilter::begin_environment()
 {
-	if (tex_envre.match(*line_, pos_)) {
-		// We assume tex_envre contains chars in the ASCII subset of
+	if (envre_.match(*line_, pos_)) {
+		// We assume envre_ contains chars in the ASCII subset of
 		// UTF-8!
-		std::advance(pos_, tex_envre.end(0));
+		std::advance(pos_, envre_.end(0));
 		
-		push_env(tex_envre.sub(*line_, 1));
+		push_env(envre_.sub(*line_, 1));
 	}
 }
 
@@ -771,12 +1022,12 @@ void TeXFilter::begin_environment()
  */
 void TeXFilter::end_environment()
 {
-	if (tex_envre.match(*line_, pos_)) {
-		// We assume tex_envre contains chars in the ASCII subset of
+	if (envre_.match(*line_, pos_)) {
+		// We assume envre_ contains chars in the ASCII subset of
 		// UTF-8!
-		std::advance(pos_, tex_envre.end(0));
+		std::advance(pos_, envre_.end(0));
 		
-		pop_env(tex_envre.sub(*line_, 1));
+		pop_env(envre_.sub(*line_, 1));
 	}
 }
 
@@ -789,7 +1040,9 @@ void TeXFilter::end_environment()
  **/
 
 /**
- * Filter for SGML, HTML, XML and the like.
+ * Filter for SGML, HTML, XML and the like. Character references, such
+ * as &auml; or &#228;, are decoded inside words, and the contents of
+ * script, style, pre and code elements are skipped.
  */
 class SGMLFilter : public PlainFilter
 {
@@ -802,9 +1055,70 @@ public:
 	virtual bool get_next_word(Glib::ustring::const_iterator* found_begin,
 				   Glib::ustring::const_iterator* found_end);
 
+	/// The word with its character references decoded
+	virtual Glib::ustring word_text(Glib::ustring::const_iterator begin,
+					Glib::ustring::const_iterator end) const;
+
+	/// Save the state of the markup
+	virtual Filter::Checkpoint* save_checkpoint() const;
+
+	/// Return to a saved state of the markup
+	virtual void restore_checkpoint(Filter::Checkpoint const& checkpoint);
+
 private:
+	/// The state of the filter
+	struct Checkpoint : public Filter::Checkpoint
+	{
+		virtual bool same_as(Filter::Checkpoint const& other) const
+			{
+				Checkpoint const& o =
+					static_cast<Checkpoint const&>(other);
+				return in_markup == o.in_markup &&
+					quote_char == o.quote_char &&
+					tag_name == o.tag_name &&
+					attribute_name == o.attribute_name &&
+					raw_text_tag == o.raw_text_tag &&
+					in_raw_text == o.in_raw_text;
+			}
+
+		bool in_markup;
+		unsigned char quote_char;
+		Glib::ustring tag_name;
+		Glib::ustring attribute_name;
+		std::string raw_text_tag;
+		bool in_raw_text;
+	};
+
 	/// Check if we are currently in a good attribute
-	bool in_good_attribute();
+	bool in_good_attribute() const;
+
+	/// Is the text at the current position to be spell checked
+	bool in_checked_text() const
+		{ return !in_markup_ || (quote_char_ != 0 &&
+					 in_good_attribute()); }
+
+	/// The character at p, which must be valid, with character
+	/// references decoded. Set *next past it.
+	gunichar char_at(Glib::ustring::const_iterator p,
+			 Glib::ustring::const_iterator* next) const
+		{
+			if (*p.base() == '&') return reference_at(p, next);
+			*next = p;
+			++*next;
+			return *p;
+		}
+
+	/// The character at p, which is at an &, like char_at
+	gunichar reference_at(Glib::ustring::const_iterator p,
+			      Glib::ustring::const_iterator* next) const;
+
+	/// Skip word characters and boundary characters inside words,
+	/// some of them perhaps character references
+	void skip_over_decoded_word();
+
+	/// Skip to the end tag of the current raw text element, or to
+	/// the end of the line
+	void skip_raw_text();
 
 	/// Are we currently in markup
 	bool in_markup_;
@@ -820,6 +1134,13 @@ private:
 
 	/// Which attributes to spell check
 	std::map<Glib::ustring, bool> attributes_to_check_;
+
+	/// The lower case name of the raw text element whose start tag we
+	/// are in or whose contents we are skipping, or empty
+	std::string raw_text_tag_;
+
+	/// Are we in the contents of the raw text element
+	bool in_raw_text_;
 };
 
 /**
@@ -827,7 +1148,8 @@ private:
  */
 SGMLFilter::SGMLFilter(Options const& options)
 	: PlainFilter(options),
-	  in_markup_(false), quote_char_(0), tag_name_(), attribute_name_()
+	  in_markup_(false), quote_char_(0), tag_name_(), attribute_name_(),
+	  raw_text_tag_(), in_raw_text_(false)
 {
 	// The format of "sgml-attributes-to-check" option is just
 	// a whitespace separated list of attributes
@@ -835,24 +1157,185 @@ SGMLFilter::SGMLFilter(Options const& options)
 					&attributes_to_check_);
 }
 
+Filter::Checkpoint* SGMLFilter::save_checkpoint() const
+{
+	Checkpoint* checkpoint = new Checkpoint;
+	checkpoint->in_markup = in_markup_;
+	checkpoint->quote_char = quote_char_;
+	checkpoint->tag_name = tag_name_;
+	checkpoint->attribute_name = attribute_name_;
+	checkpoint->raw_text_tag = raw_text_tag_;
+	checkpoint->in_raw_text = in_raw_text_;
+	return checkpoint;
+}
+
+void SGMLFilter::restore_checkpoint(Filter::Checkpoint const& checkpoint)
+{
+	Checkpoint const& c = static_cast<Checkpoint const&>(checkpoint);
+	in_markup_ = c.in_markup;
+	quote_char_ = c.quote_char;
+	tag_name_ = c.tag_name;
+	attribute_name_ = c.attribute_name;
+	raw_text_tag_ = c.raw_text_tag;
+	in_raw_text_ = c.in_raw_text;
+}
+
 /**
  * Check whether we want to spell check this attribute
  * That is, is it in attributes_to_check_?
  */
-bool SGMLFilter::in_good_attribute()
+bool SGMLFilter::in_good_attribute() const
 {
 	return attribute_name_.empty() || // Malformed input?
 		(attributes_to_check_.find(attribute_name_)
 		 != attributes_to_check_.end());
 }
 
+/** Is the lower case name one of an element whose contents are skipped? */
+static bool is_raw_text_element(std::string const& name)
+{
+	return name == "script" || name == "style" || name == "pre" ||
+		name == "code";
+}
+
+/**
+ * Decode the character reference at p, just after its &, such as auml;
+ * or #228; or #xE4; or a legacy reference such as auml without the ;.
+ * Store its characters to chars, the second being 0 if there is only
+ * one. Set *next past the reference and return true, or return false if
+ * there is no reference.
+ */
+static bool decode_reference(std::string::const_iterator p,
+			     std::string::const_iterator end,
+			     gunichar chars[2],
+			     std::string::const_iterator* next)
+{
+	chars[1] = 0;
+
+	if (p != end && *p == '#') {
+		++p;
+		bool hex = (p != end && (*p == 'x' || *p == 'X'));
+		if (hex) ++p;
+
+		std::string::const_iterator digits = p;
+		unsigned long value = 0;
+		for (; p != end && (unsigned char)*p < 0x80 &&
+			     (hex ? isxdigit(*p) : isdigit(*p)); ++p) {
+			if (value <= 0x10FFFF)
+				value = value * (hex ? 16 : 10) +
+					g_ascii_xdigit_value(*p);
+		}
+		if (p == digits) return false;
+		if (p != end && *p == ';') ++p;
+
+		// Null, surrogates and too large values are replaced
+		if (value == 0 || value > 0x10FFFF ||
+		    (value >= 0xD800 && value <= 0xDFFF))
+			value = 0xFFFD;
+		chars[0] = value;
+		*next = p;
+		return true;
+	}
+
+	std::string::const_iterator name = p;
+	while (p != end && is_ascii_alnum(*p)) ++p;
+	if (p == name) return false;
+	bool semicolon = (p != end && *p == ';');
+
+	HtmlEntity const* entity = find_html_entity(&*name, &*name + (p - name));
+	if (entity == 0 || !(semicolon || entity->legacy)) return false;
+
+	chars[0] = entity->chars[0];
+	chars[1] = entity->chars[1];
+	*next = semicolon ? p + 1 : p;
+	return true;
+}
+
+gunichar SGMLFilter::reference_at(Glib::ustring::const_iterator p,
+				  Glib::ustring::const_iterator* next) const
+{
+	std::string::const_iterator after;
+	gunichar chars[2];
+	if (decode_reference(p.base() + 1, line_->raw().end(), chars,
+			     &after)) {
+		*next = Glib::ustring::const_iterator(after);
+		return chars[0];
+	}
+	*next = p;
+	++*next;
+	return '&';
+}
+
+void SGMLFilter::skip_over_decoded_word()
+{
+	Glib::ustring::const_iterator next, after;
+	while (is_pos_valid()) {
+		gunichar c = char_at(pos_, &next);
+		if (!is_word_char(c)) {
+			if (!is_boundary_char(c) || next == line_->end() ||
+			    !is_word_char(char_at(next, &after)))
+				break;
+		}
+		pos_ = next;
+	}
+}
+
+Glib::ustring SGMLFilter::word_text(Glib::ustring::const_iterator begin,
+				    Glib::ustring::const_iterator end) const
+{
+	std::string::const_iterator p = begin.base();
+	if (std::find(p, end.base(), '&') == end.base())
+		return Glib::ustring(begin, end);
+
+	std::string text;
+	while (p != end.base()) {
+		std::string::const_iterator next;
+		gunichar chars[2];
+		if (*p == '&' &&
+		    decode_reference(p + 1, end.base(), chars, &next)) {
+			text += Glib::ustring(1, chars[0]).raw();
+			if (chars[1] != 0)
+				text += Glib::ustring(1, chars[1]).raw();
+			p = next;
+		} else {
+			text += *p++;
+		}
+	}
+	return Glib::ustring(text);
+}
+
+/**
+ * Find the end tag of the raw text element by searching for "</" and
+ * comparing the tag name, ignoring case.
+ */
+void SGMLFilter::skip_raw_text()
+{
+	std::string const& raw = line_->raw();
+	std::string::size_type i = pos_.base() - raw.begin();
+	std::string::size_type n = raw_text_tag_.size();
+
+	while ((i = raw.find("</", i)) != std::string::npos) {
+		std::string::size_type j = 0;
+		while (j < n && i + 2 + j < raw.size() &&
+		       g_ascii_tolower(raw[i + 2 + j]) == raw_text_tag_[j])
+			++j;
+		if (j == n && (i + 2 + n == raw.size() ||
+			       !is_ascii_alnum(raw[i + 2 + n]))) {
+			pos_ = Glib::ustring::const_iterator(raw.begin() + i);
+			in_raw_text_ = false;
+			raw_text_tag_.clear();
+			return;
+		}
+		i += 2;
+	}
+	pos_ = line_->end();
+}
+
 /**
  * Return the next word to be spell checked.
  * Skip markup and spell check only attributes appearing in
- * attributes_to_check_.
- *
- * FIXME: We need an entity encoder and decoder, but it requires changes
- * FIXME: to the filter architecture. (The changes are on TODO list.)
+ * attributes_to_check_. A word may start with, end with or contain
+ * character references.
  */
 bool SGMLFilter::get_next_word(Glib::ustring::const_iterator* found_begin,
 			       Glib::ustring::const_iterator* found_end)
@@ -860,12 +1343,20 @@ bool SGMLFilter::get_next_word(Glib::ustring::const_iterator* found_begin,
 	skip_whitespace();
 	while (is_pos_valid())
 	{
-		
+		Glib::ustring::const_iterator next;
+
+		// Skip the contents of script, style, pre and code
+		if (in_raw_text_) {
+			skip_raw_text();
+			if (!is_pos_valid()) break;
+		}
+
 		// Handle the beginning of a tag
 		if (*pos_ == '<') {
 			++pos_;
 
-			if (is_at('/')) // End tag
+			bool end_tag = is_at('/');
+			if (end_tag)
 				++pos_;
 
 			// Get the tag name
@@ -881,6 +1372,16 @@ bool SGMLFilter::get_next_word(Glib::ustring::const_iterator* found_begin,
 			}
 			in_markup_ = true;
 			attribute_name_.resize(0);
+
+			raw_text_tag_.clear();
+			if (!end_tag) {
+				for (std::string::const_iterator c =
+					     tag_name_.raw().begin();
+				     c != tag_name_.raw().end(); ++c)
+					raw_text_tag_ += g_ascii_tolower(*c);
+				if (!is_raw_text_element(raw_text_tag_))
+					raw_text_tag_.clear();
+			}
 		}
 		// Handle the end of a tag
 		else if (*pos_ == '>') {
@@ -888,12 +1389,14 @@ bool SGMLFilter::get_next_word(Glib::ustring::const_iterator* found_begin,
 			in_markup_ = false;
 			tag_name_.resize(0);
 			attribute_name_.resize(0);
+			in_raw_text_ = !raw_text_tag_.empty();
 		}
 		// Handle a SGML shortened tag
 		else if (*pos_ == '/' && in_markup_ && quote_char_ == 0) {
 			++pos_;
 			tag_name_.resize(0);
 			attribute_name_.resize(0);
+			raw_text_tag_.clear();
 			in_markup_ = false;
 		}
 		// Handle a quote
@@ -917,30 +1420,24 @@ bool SGMLFilter::get_next_word(Glib::ustring::const_iterator* found_begin,
 			       *pos_ != '\'') ++pos_;
 			attribute_name_.assign(beg, pos_);
 		}
-		// Skip entities
-		else if ((!in_markup_ || quote_char_ != 0) && *pos_ == '&') {
-			++pos_;
-			while (is_pos_valid() && isalnum(*pos_) &&
-			       *pos_ != ';') ++pos_;
-			if (is_at(';')) ++pos_;
-		}
-		// We are at a word
-		else if (is_at_word()) {
+		// We are at a word, or at a reference to a word character
+		else if (is_word_char(char_at(pos_, &next))) {
 
 			// Decide whether whe should spell check this word
-			if (!in_markup_ ||
-			    (quote_char_ != 0 && in_good_attribute())) {
-				return PlainFilter::get_next_word(found_begin,
-								  found_end);
-			} else {
-				++pos_;
+			if (!in_checked_text()) {
+				pos_ = next;
 				while (is_pos_valid() && isalnum(*pos_))
 					++pos_;
+			} else if (!skip_token()) {
+				*found_begin = pos_;
+				skip_over_decoded_word();
+				*found_end = pos_;
+				return true;
 			}
 		}
-		// We are somewhere else: just skip it
+		// We are somewhere else, perhaps at a reference: skip it
 		else {
-			++pos_;
+			pos_ = next;
 		}
 
 		skip_whitespace();
@@ -977,8 +1474,33 @@ public:
 	/// Get next whole word from the line.
 	virtual bool get_next_word(Glib::ustring::const_iterator* found_begin,
 				   Glib::ustring::const_iterator* found_end);
+
+	/// Save whether the line has changed
+	virtual Filter::Checkpoint* save_checkpoint() const
+		{
+			Checkpoint* checkpoint = new Checkpoint;
+			checkpoint->line_changed = line_changed_;
+			return checkpoint;
+		}
+
+	/// Return to a saved state
+	virtual void restore_checkpoint(Filter::Checkpoint const& checkpoint)
+		{
+			line_changed_ = static_cast<Checkpoint const&>(
+				checkpoint).line_changed;
+		}
 	
 private:
+	/// The state of the filter
+	struct Checkpoint : public Filter::Checkpoint
+	{
+		virtual bool same_as(Filter::Checkpoint const& other) const
+			{ return line_changed == static_cast<Checkpoint const&>(
+				  other).line_changed; }
+
+		bool line_changed;
+	};
+
 	bool is_at_request(Glib::ustring const& request,
 			   Glib::ustring::const_iterator* end);
 
@@ -1092,8 +1614,7 @@ bool NroffFilter::get_next_word(Glib::ustring::const_iterator* found_begin,
 		}
 		// Word, try and get it
 		else if (is_at_word()) {
-			return PlainFilter::get_next_word(found_begin,
-							  found_end);
+			return get_word(found_begin, found_end);
 		}
 		// Something else: skip it
 		else {
@@ -1107,6 +1628,814 @@ bool NroffFilter::get_next_word(Glib::ustring::const_iterator* found_begin,
 /** @} */
 
 
+/****************************************************************************/
+/** @name Filtering Markdown
+ ** @{
+ **/
+
+/**
+ * Filter for Markdown, as in CommonMark and GitHub.
+ *
+ * Code blocks, code spans, link destinations and labels, autolinks,
+ * bare URLs, HTML tags and comments, entities and a YAML front matter
+ * are skipped; the rest is checked like plain text. Link texts, image
+ * descriptions and headings are checked.
+ *
+ * The block structure is looked at when the first word of a line is
+ * asked for, from the position given to reset, so that the pipe mode may
+ * skip its command character. Open fences and HTML comments carry over
+ * to the following lines, so the lines must be fed in order. A code span
+ * has to be closed on the line it is opened on: a lone backtick is taken
+ * literally, rather than hiding the text after it up to a blank line.
+ */
+class MarkdownFilter : public PlainFilter
+{
+public:
+	/// Initialize the word character table.
+	MarkdownFilter(Options const& options);
+	virtual ~MarkdownFilter() {}
+
+	/// Set a new line.
+	virtual void set_line(Glib::ustring const* line)
+		{
+			PlainFilter::set_line(line);
+			line_start_ = true;
+			literal_markup_ = false;
+		}
+
+	/// Get next whole word from the line.
+	virtual bool get_next_word(Glib::ustring::const_iterator* found_begin,
+				   Glib::ustring::const_iterator* found_end);
+
+	/// Save the state of the blocks and spans
+	virtual Filter::Checkpoint* save_checkpoint() const;
+
+	/// Return to a saved state of the blocks and spans
+	virtual void restore_checkpoint(Filter::Checkpoint const& checkpoint);
+
+private:
+	/// The state of the filter
+	struct Checkpoint : public Filter::Checkpoint
+	{
+		virtual bool same_as(Filter::Checkpoint const& other) const
+			{
+				Checkpoint const& o =
+					static_cast<Checkpoint const&>(other);
+				return line_start == o.line_start &&
+					skip_line == o.skip_line &&
+					lines == o.lines &&
+					in_front_matter == o.in_front_matter &&
+					fence_char == o.fence_char &&
+					fence_length == o.fence_length &&
+					in_indented_code ==
+					o.in_indented_code &&
+					blank_before == o.blank_before &&
+					in_list == o.in_list &&
+					in_html_comment == o.in_html_comment;
+			}
+
+		bool line_start;
+		bool skip_line;
+		unsigned long lines;
+		bool in_front_matter;
+		gunichar fence_char;
+		unsigned int fence_length;
+		bool in_indented_code;
+		bool blank_before;
+		bool in_list;
+		bool in_html_comment;
+	};
+
+	/// Look at the block structure at the start of the line
+	void parse_line_start();
+
+	/// Is the line only whitespace from p on?
+	bool is_blank_from(Glib::ustring::const_iterator p) const;
+
+	/// Skip a code span, or only its backticks if it is not closed
+	void skip_code_span();
+
+	/// Skip a link destination, at its (
+	void skip_link_destination();
+
+	/// Skip to the end of the line
+	void skip_line() { pos_ = line_->end(); }
+
+	/// Is the block structure of the line yet to be looked at?
+	bool line_start_;
+
+	/// Is the current line to be skipped wholly?
+	bool skip_line_;
+
+	/// The number of lines seen
+	unsigned long lines_;
+
+	/// Are we in a YAML front matter?
+	bool in_front_matter_;
+
+	/// The character of the open code fence, or 0
+	gunichar fence_char_;
+
+	/// The length of the open code fence
+	unsigned int fence_length_;
+
+	/// Are we in an indented code block?
+	bool in_indented_code_;
+
+	/// Was the previous line blank?
+	bool blank_before_;
+
+	/// Are we in a list, where indented lines are not code?
+	bool in_list_;
+
+	/// Are we in an HTML comment?
+	bool in_html_comment_;
+
+	/// Were backticks or a < taken literally before on this line? An edit
+	/// after them may close a code span or a tag, so no checkpoint is
+	/// saved until the line ends.
+	bool literal_markup_;
+};
+
+MarkdownFilter::MarkdownFilter(Options const& options)
+	: PlainFilter(options),
+	  line_start_(true), skip_line_(false), lines_(0),
+	  in_front_matter_(false), fence_char_(0), fence_length_(0),
+	  in_indented_code_(false), blank_before_(true), in_list_(false),
+	  in_html_comment_(false), literal_markup_(false)
+{
+}
+
+Filter::Checkpoint* MarkdownFilter::save_checkpoint() const
+{
+	if (literal_markup_) return 0;
+
+	Checkpoint* checkpoint = new Checkpoint;
+	checkpoint->line_start = line_start_;
+	checkpoint->skip_line = skip_line_;
+	checkpoint->lines = lines_;
+	checkpoint->in_front_matter = in_front_matter_;
+	checkpoint->fence_char = fence_char_;
+	checkpoint->fence_length = fence_length_;
+	checkpoint->in_indented_code = in_indented_code_;
+	checkpoint->blank_before = blank_before_;
+	checkpoint->in_list = in_list_;
+	checkpoint->in_html_comment = in_html_comment_;
+	return checkpoint;
+}
+
+void MarkdownFilter::restore_checkpoint(Filter::Checkpoint const& checkpoint)
+{
+	Checkpoint const& c = static_cast<Checkpoint const&>(checkpoint);
+	line_start_ = c.line_start;
+	skip_line_ = c.skip_line;
+	lines_ = c.lines;
+	in_front_matter_ = c.in_front_matter;
+	fence_char_ = c.fence_char;
+	fence_length_ = c.fence_length;
+	in_indented_code_ = c.in_indented_code;
+	blank_before_ = c.blank_before;
+	in_list_ = c.in_list;
+	in_html_comment_ = c.in_html_comment;
+	literal_markup_ = false;
+}
+
+bool MarkdownFilter::is_blank_from(Glib::ustring::const_iterator p) const
+{
+	for (; p != line_->end(); ++p) {
+		if (!Glib::Unicode::isspace(*p)) return false;
+	}
+	return true;
+}
+
+/**
+ * Decide what the line is from its start: a part of a front matter or of
+ * a code block, a fence, a link reference definition, or something to be
+ * checked. List items are noted, since lines indented in them are not
+ * code.
+ */
+void MarkdownFilter::parse_line_start()
+{
+	++lines_;
+	skip_line_ = false;
+
+	Glib::ustring::const_iterator p = pos_;
+	unsigned int indent = 0;
+	for (; p != line_->end() && (*p == ' ' || *p == '\t'); ++p)
+		indent = (*p == '\t') ? (indent + 4) & ~3 : indent + 1;
+	bool blank = is_blank_from(p);
+
+	// A front matter, from --- on the first line to --- or ...
+	bool delimiter = indent == 0 &&
+		(run_length(p, '-') == 3 || run_length(p, '.') == 3) &&
+		is_blank_from(Glib::ustring::const_iterator(p.base() + 3));
+	if (lines_ == 1 && delimiter && *p == '-') {
+		in_front_matter_ = true;
+		skip_line_ = true;
+		return;
+	} else if (in_front_matter_) {
+		if (delimiter) in_front_matter_ = false;
+		skip_line_ = true;
+		return;
+	}
+
+	// In a fenced code block: look for the closing fence
+	if (fence_char_ != 0) {
+		unsigned int n = run_length(p, fence_char_);
+		if (indent < 4 && n >= fence_length_ &&
+		    is_blank_from(Glib::ustring::const_iterator(p.base() + n)))
+			fence_char_ = 0;
+		skip_line_ = true;
+		return;
+	}
+
+	if (blank) {
+		blank_before_ = true;
+		skip_line_ = true;
+		return;
+	}
+
+	// In an indented code block, or at the start of one
+	if (indent >= 4 && (in_indented_code_ ||
+			    (blank_before_ && !in_list_))) {
+		in_indented_code_ = true;
+		skip_line_ = true;
+		return;
+	}
+	in_indented_code_ = false;
+
+	bool blank_before = blank_before_;
+	blank_before_ = false;
+	if (indent >= 4) return;
+
+	// The opening fence of a code block
+	if (p != line_->end() && (*p == '`' || *p == '~')) {
+		unsigned int n = run_length(p, *p);
+		if (n >= 3) {
+			fence_char_ = *p;
+			fence_length_ = n;
+			skip_line_ = true;
+			return;
+		}
+	}
+
+	// A link reference definition: [label]: destination "title"
+	if (p != line_->end() && *p == '[') {
+		Glib::ustring::const_iterator q = p;
+		while (q != line_->end() && *q != ']') ++q;
+		if (q != line_->end() && ++q != line_->end() && *q == ':') {
+			skip_line_ = true;
+			return;
+		}
+	}
+
+	// A list item: -, + or * or a number and . or ), then a space
+	Glib::ustring::const_iterator q = p;
+	if (q != line_->end() && (*q == '-' || *q == '+' || *q == '*')) {
+		++q;
+	} else {
+		while (q != line_->end() && *q >= '0' && *q <= '9') ++q;
+		if (q != p && q != line_->end() && (*q == '.' || *q == ')'))
+			++q;
+		else
+			q = p;
+	}
+	if (q != p && (q == line_->end() || *q == ' ' || *q == '\t'))
+		in_list_ = true;
+	else if (indent == 0 && blank_before)
+		in_list_ = false;
+}
+
+/**
+ * Skip a link destination from its (, and the ) after it if there is no
+ * title. Parentheses inside the destination may nest.
+ */
+void MarkdownFilter::skip_link_destination()
+{
+	++pos_;
+	skip_whitespace();
+	if (is_at('<')) {
+		while (is_pos_valid() && *pos_ != '>') ++pos_;
+		if (is_pos_valid()) ++pos_;
+	} else {
+		int depth = 0;
+		while (is_pos_valid() && !Glib::Unicode::isspace(*pos_)) {
+			if (*pos_ == '(') {
+				++depth;
+			} else if (*pos_ == ')') {
+				if (depth == 0) break;
+				--depth;
+			} else if (*pos_ == '\\') {
+				++pos_;
+				if (!is_pos_valid()) break;
+			}
+			++pos_;
+		}
+	}
+	if (is_at(')')) ++pos_;
+}
+
+/**
+ * Skip a code span at its opening run of backticks, up to a closing run of
+ * as many backticks on the same line. Without one, only the opening run is
+ * skipped.
+ */
+void MarkdownFilter::skip_code_span()
+{
+	unsigned int ticks = run_length(pos_, '`');
+	skip_n(ticks);
+
+	Glib::ustring::const_iterator p = pos_;
+	while (p != line_->end()) {
+		if (*p != '`') {
+			++p;
+			continue;
+		}
+		unsigned int n = run_length(p, '`');
+		for (unsigned int i = 0; i < n; ++i) ++p;
+		if (n == ticks) {
+			pos_ = p;
+			return;
+		}
+	}
+	literal_markup_ = true;
+}
+
+/**
+ * Return the next word to be spell checked, skipping code, link
+ * destinations, URLs and markup.
+ */
+bool MarkdownFilter::get_next_word(Glib::ustring::const_iterator* found_begin,
+				   Glib::ustring::const_iterator* found_end)
+{
+	if (line_start_) {
+		line_start_ = false;
+		parse_line_start();
+	}
+	if (skip_line_) return false;
+
+	skip_whitespace();
+	while (is_pos_valid()) {
+		// In an HTML comment: look for its end
+		if (in_html_comment_) {
+			while (is_pos_valid() && !is_at("-->")) ++pos_;
+			if (is_pos_valid()) {
+				skip_n(3);
+				in_html_comment_ = false;
+			}
+		}
+		// A backslash escape
+		else if (*pos_ == '\\') {
+			++pos_;
+			if (is_pos_valid() && *pos_ < 0x80 &&
+			    ispunct(*pos_)) ++pos_;
+		}
+		// A code span, or a literal run of backticks
+		else if (*pos_ == '`') {
+			skip_code_span();
+		}
+		// An HTML comment, tag or an autolink
+		else if (*pos_ == '<') {
+			if (is_at("<!--")) {
+				skip_n(4);
+				in_html_comment_ = true;
+			} else {
+				Glib::ustring::const_iterator p = pos_;
+				++p;
+				if (p != line_->end() &&
+				    (*p == '/' || *p == '!' || *p == '?' ||
+				     (*p < 0x80 && isalpha(*p)))) {
+					while (p != line_->end() && *p != '>')
+						++p;
+				}
+				if (p != line_->end() && *p == '>') {
+					pos_ = ++p;
+				} else {
+					++pos_;
+					literal_markup_ = true;
+				}
+			}
+		}
+		// A footnote reference or label
+		else if (is_at("[^")) {
+			while (is_pos_valid() && *pos_ != ']') ++pos_;
+		}
+		// The end of a link text, and its destination or label
+		else if (*pos_ == ']') {
+			++pos_;
+			if (is_at('(')) {
+				skip_link_destination();
+			} else if (is_at('[')) {
+				while (is_pos_valid() && *pos_ != ']') ++pos_;
+				if (is_pos_valid()) ++pos_;
+			}
+		}
+		// An entity
+		else if (*pos_ == '&') {
+			++pos_;
+			if (is_at('#')) ++pos_;
+			while (is_pos_valid() && *pos_ < 0x80 && isalnum(*pos_))
+				++pos_;
+			if (is_at(';')) ++pos_;
+		}
+		// We are at a word, unless at a bare URL or the like
+		else if (is_at_word()) {
+			if (!skip_token())
+				return get_word(found_begin, found_end);
+		}
+		// We are somewhere else: just skip it
+		else {
+			++pos_;
+		}
+
+		skip_whitespace();
+	}
+	literal_markup_ = false;
+	return false;
+}
+
+/** @} */
+
+
+/****************************************************************************/
+/** @name Filtering source code
+ ** @{
+ **/
+
+/**
+ * Filter for program source code: checks only the comments and string
+ * literals. C-family languages have comments in slash-star and double
+ * slash, string literals in double quotes and character literals in single
+ * quotes; JavaScript has the same comments, and strings in single or
+ * double quotes; script languages have comments starting with a hash mark
+ * and strings in single, double or tripled quotes.
+ *
+ * A single quote in C-family code starts a character literal only if it
+ * closes right after one character or escape, so that Rust lifetimes like
+ * 'a and digit separators like 1'000 are read as code.
+ *
+ * Identifiers mentioned in the checked text, such as foo_bar, fooBar,
+ * x86 or foo(), are skipped, as are escape sequences, printf conversions
+ * and documentation tags like \@param with the name after them.
+ *
+ * Block comments, tripled-quoted strings and strings continued with a
+ * backslash carry over to the following lines, so the lines must be fed
+ * in order.
+ */
+class SourceFilter : public PlainFilter
+{
+public:
+	/// The comment and string syntax of a language
+	typedef enum {
+		c_family, ///< C, C++, Java, Rust and the like
+		js_family, ///< JavaScript and TypeScript
+		hash      ///< Shell, Python, Perl, Ruby and the like
+	} Syntax;
+
+	/// Initialize the word character table.
+	SourceFilter(Options const& options, Syntax syntax);
+	virtual ~SourceFilter() {}
+
+	/// Set a new line.
+	virtual void set_line(Glib::ustring const* line)
+		{ PlainFilter::set_line(line); parse_line_change(); }
+
+	/// Get next whole word from the line.
+	virtual bool get_next_word(Glib::ustring::const_iterator* found_begin,
+				   Glib::ustring::const_iterator* found_end);
+
+	/// Save the comment or string we are in
+	virtual Filter::Checkpoint* save_checkpoint() const;
+
+	/// Return to a saved comment or string
+	virtual void restore_checkpoint(Filter::Checkpoint const& checkpoint);
+
+private:
+	/// What we are in
+	typedef enum {
+		in_code,          ///< Program code, not checked
+		in_line_comment,  ///< A comment to the end of the line
+		in_block_comment, ///< A comment ended by star-slash
+		in_string,        ///< A string ended by quote_
+		in_long_string    ///< A string ended by three quote_
+	} State;
+
+	/// End the line comments and strings not continued at a new line
+	void parse_line_change();
+
+	/// Skip code up to the start of a comment or a string
+	void skip_code();
+
+	/// Skip a C character literal if there is one here
+	bool skip_char_literal();
+
+	/// Are we at the end of the current comment or string? Skip it if so.
+	bool skip_end_of_text();
+
+	/// Skip an identifier or a number if there is one here
+	bool skip_identifier();
+
+	/// Skip an escape, a printf conversion or a tag if there is one here
+	bool skip_special();
+
+	/// The syntax of the language
+	Syntax syntax_;
+
+	/// What we are in
+	State state_;
+
+	/// The quote ending the current string
+	gunichar quote_;
+
+	/// Did the string continue to the next line with a backslash?
+	bool continued_;
+
+	/// Is the current line to be skipped wholly?
+	bool skip_line_;
+
+	/// The number of lines seen
+	unsigned long lines_;
+
+	/// The state of the filter
+	struct Checkpoint : public Filter::Checkpoint
+	{
+		virtual bool same_as(Filter::Checkpoint const& other) const
+			{
+				Checkpoint const& o =
+					static_cast<Checkpoint const&>(other);
+				return state == o.state && quote == o.quote &&
+					continued == o.continued &&
+					skip_line == o.skip_line &&
+					lines == o.lines;
+			}
+
+		State state;
+		gunichar quote;
+		bool continued;
+		bool skip_line;
+		unsigned long lines;
+	};
+};
+
+SourceFilter::SourceFilter(Options const& options, Syntax syntax)
+	: PlainFilter(options), syntax_(syntax), state_(in_code), quote_(0),
+	  continued_(false), skip_line_(false), lines_(0)
+{
+}
+
+/**
+ * Tell the parser that a line has changed. Line comments end, and so do
+ * strings in single quotes unless the previous line ended in a backslash.
+ */
+void SourceFilter::parse_line_change()
+{
+	++lines_;
+	if (state_ == in_line_comment || (state_ == in_string && !continued_))
+		state_ = in_code;
+	continued_ = false;
+
+	// Neither a shebang line nor the file name of an #include is text
+	skip_line_ = false;
+	if (lines_ == 1 && syntax_ == hash && is_at("#!")) {
+		skip_line_ = true;
+	} else if (syntax_ == c_family && state_ == in_code) {
+		skip_whitespace();
+		skip_line_ = is_at("#include") || is_at("#import");
+		pos_ = line_->begin();
+	}
+}
+
+Filter::Checkpoint* SourceFilter::save_checkpoint() const
+{
+	Checkpoint* checkpoint = new Checkpoint;
+	checkpoint->state = state_;
+	checkpoint->quote = quote_;
+	checkpoint->continued = continued_;
+	checkpoint->skip_line = skip_line_;
+	checkpoint->lines = lines_;
+	return checkpoint;
+}
+
+void SourceFilter::restore_checkpoint(Filter::Checkpoint const& checkpoint)
+{
+	Checkpoint const& c = static_cast<Checkpoint const&>(checkpoint);
+	state_ = c.state;
+	quote_ = c.quote;
+	continued_ = c.continued;
+	skip_line_ = c.skip_line;
+	lines_ = c.lines;
+}
+
+/**
+ * Skip program code until a comment or a string starts, and enter it.
+ */
+void SourceFilter::skip_code()
+{
+	while (is_pos_valid()) {
+		gunichar c = *pos_;
+		if (syntax_ != hash) {
+			if (is_at("/*")) {
+				skip_n(2);
+				state_ = in_block_comment;
+				return;
+			} else if (is_at("//")) {
+				skip_n(2);
+				state_ = in_line_comment;
+				return;
+			} else if (c == '\'' && syntax_ == c_family) {
+				if (!skip_char_literal()) ++pos_;
+				continue;
+			}
+		} else if (c == '#') {
+			// Not a comment in $# or ${#name} of shells
+			Glib::ustring::const_iterator p = pos_;
+			if (p == line_->begin() ||
+			    (*--p != '$' && *p != '{')) {
+				++pos_;
+				state_ = in_line_comment;
+				return;
+			}
+		} else if (is_at("\"\"\"") || is_at("'''")) {
+			quote_ = c;
+			skip_n(3);
+			state_ = in_long_string;
+			return;
+		}
+
+		if (c == '"' || c == '\'') {
+			quote_ = c;
+			++pos_;
+			state_ = in_string;
+			return;
+		}
+		++pos_;
+	}
+}
+
+/**
+ * Skip a character literal like 'a', '\n', '\x41' or '\u1234' from its
+ * quote. Return false, without moving, if the quote does not close after
+ * one character or escape.
+ */
+bool SourceFilter::skip_char_literal()
+{
+	Glib::ustring::const_iterator p = pos_;
+	Glib::ustring::const_iterator end = line_->end();
+
+	if (++p == end) return false;
+	if (*p == '\\') {
+		// An escape: the character after the backslash, and at most
+		// eight more for \U0001F600 and the like
+		if (++p == end) return false;
+		++p;
+		for (int n = 0; p != end && *p != '\'' && n < 8; ++n) ++p;
+	} else if (*p != '\'') {
+		++p;
+	} else {
+		return false;
+	}
+
+	if (p == end || *p != '\'') return false;
+	pos_ = ++p;
+	return true;
+}
+
+bool SourceFilter::skip_end_of_text()
+{
+	switch (state_) {
+	case in_block_comment:
+		if (!is_at("*/")) return false;
+		skip_n(2);
+		break;
+	case in_string:
+		if (*pos_ != quote_) return false;
+		++pos_;
+		break;
+	case in_long_string:
+		if (run_length(pos_, quote_) < 3) return false;
+		skip_n(3);
+		break;
+	default:
+		return false;
+	}
+	state_ = in_code;
+	return true;
+}
+
+/**
+ * Skip a token of letters, digits and underscores if it looks like an
+ * identifier or a number: it has an underscore or a digit, a lowercase
+ * letter followed by an uppercase one, or a parenthesis after it.
+ */
+bool SourceFilter::skip_identifier()
+{
+	Glib::ustring::const_iterator p = pos_;
+	bool identifier = false;
+	gunichar prev = 0;
+	for (; p != line_->end(); ++p) {
+		gunichar c = *p;
+		if (c == '_' || Glib::Unicode::isdigit(c)) {
+			identifier = true;
+		} else if (Glib::Unicode::isalpha(c)) {
+			if (Glib::Unicode::isupper(c) && prev != 0 &&
+			    Glib::Unicode::islower(prev))
+				identifier = true;
+		} else {
+			break;
+		}
+		prev = c;
+	}
+	if (p != line_->end() && *p == '(') identifier = true;
+
+	if (!identifier) return false;
+	pos_ = p;
+	return true;
+}
+
+/**
+ * Skip a backslash escape or a printf conversion in a string, or a
+ * documentation tag like \@param or \\brief in a comment.
+ */
+bool SourceFilter::skip_special()
+{
+	gunichar c = *pos_;
+	bool string = (state_ == in_string || state_ == in_long_string);
+
+	if (c == '\\' || (c == '@' && !string)) {
+		++pos_;
+		if (string) {
+			if (is_pos_valid()) ++pos_;
+			return true;
+		}
+
+		Glib::ustring::const_iterator name = pos_;
+		while (is_pos_valid() && *pos_ < 0x80 && isalpha(*pos_))
+			++pos_;
+
+		// Tags followed by the name of a parameter or an entity
+		static char const* const named[] = {
+			"param", "tparam", "throw", "throws", "exception",
+			"retval", "ref", "see", "p", "a", "c"
+		};
+		Glib::ustring tag(name, pos_);
+		for (unsigned int i = 0; i < sizeof(named) / sizeof(*named);
+		     ++i) {
+			if (tag == named[i]) {
+				skip_whitespace();
+				skip_non_whitespace();
+				break;
+			}
+		}
+		return true;
+	} else if (c == '%' && string) {
+		++pos_;
+		while (is_pos_valid() && *pos_ < 0x80 &&
+		       strchr("-+ #0123456789.*lhzjtL", *pos_)) ++pos_;
+		if (is_pos_valid() && *pos_ < 0x80 && isalpha(*pos_)) ++pos_;
+		return true;
+	}
+	return false;
+}
+
+/**
+ * Return the next word in a comment or a string.
+ */
+bool SourceFilter::get_next_word(Glib::ustring::const_iterator* found_begin,
+				 Glib::ustring::const_iterator* found_end)
+{
+	if (skip_line_) return false;
+
+	while (is_pos_valid()) {
+		if (state_ == in_code) {
+			skip_code();
+		} else if (skip_end_of_text() || skip_special()) {
+			// Skipped
+		} else if (is_at_word() || is_at('_')) {
+			if (skip_identifier() || skip_token()) {
+				// Skipped
+			} else if (is_at_word()) {
+				return get_word(found_begin, found_end);
+			} else {
+				++pos_;
+			}
+		} else {
+			++pos_;
+		}
+	}
+
+	// A string continued on the next line
+	if (state_ == in_string && !line_->empty()) {
+		Glib::ustring::const_iterator p = line_->end();
+		while (p != line_->begin() && (*--p == '\n' || *p == '\r'))
+			;
+		continued_ = (*p == '\\');
+	}
+	return false;
+}
+
+/** @} */
+
+
 /****************************************************************************/
 /** @name Filter selection
  ** @{
@@ -1123,6 +2452,13 @@ Filter* Filter::new_filter(Options::FilterType type, Options const& options)
 	case Options::nroff: return new NroffFilter(options);
 	case Options::tex: return new TeXFilter(options);
 	case Options::sgml: return new SGMLFilter(options);
+	case Options::markdown: return new MarkdownFilter(options);
+	case Options::csource:
+		return new SourceFilter(options, SourceFilter::c_family);
+	case Options::jsource:
+		return new SourceFilter(options, SourceFilter::js_family);
+	case Options::script:
+		return new SourceFilter(options, SourceFilter::hash);
 	default:
 		//std::cerr << "Requested filter not implemented" << std::endl;
 		break;
@@ -27,6 +27,7 @@
 #include "glibmm/ustring.h"
 
 #include "options.hh"
+#include "statistics.hh"
 
 /**
  * An interface to retrieve words from a text stream.
@@ -54,6 +55,42 @@ public:
 	virtual bool get_next_word(Glib::ustring::const_iterator* found_begin,
 				   Glib::ustring::const_iterator* found_end)=0;
 
+	/// The text of the word [begin, end) to spell check. Filters that
+	/// decode markup inside words, such as entities, override this.
+	virtual Glib::ustring word_text(Glib::ustring::const_iterator begin,
+					Glib::ustring::const_iterator end) const
+		{ return Glib::ustring(begin, end); }
+
+	/**
+	 * A saved state of a filter, from which filtering can go on. It
+	 * does not include the line or the position in it.
+	 */
+	class Checkpoint
+	{
+	public:
+		virtual ~Checkpoint() {}
+
+		/// Does filtering go on the same way from this state as from
+		/// the other, saved by the same filter?
+		virtual bool same_as(Checkpoint const& other) const = 0;
+	};
+
+	/// Save the state after the word found last, or between lines.
+	/// Return 0 if the filter cannot go on from a saved state.
+	virtual Checkpoint* save_checkpoint() const { return 0; }
+
+	/// Return to a state saved by this filter. To go on after a word,
+	/// call this after set_line and reset to the end of the word; to
+	/// start a line, before set_line.
+	virtual void restore_checkpoint(Checkpoint const&) {}
+
+	/// Get the next whole word in line, timing it for the statistics
+	bool next_word(Glib::ustring::const_iterator* found_begin,
+		       Glib::ustring::const_iterator* found_end) {
+		Statistics::Timer timer(Statistics::filter);
+		return get_next_word(found_begin, found_end);
+	}
+
 protected:
 	/// The line to be filtered
 	Glib::ustring const* line_;
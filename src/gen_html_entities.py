@@ -0,0 +1,183 @@
+#!/usr/bin/env python3
+# Copyright (C) Pauli Virtanen
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU General Public License
+# as published by the Free Software Foundation; either version 2
+# of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software
+# Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+
+"""
+Generate html_entities.cc, the perfect hash table of the named character
+references of HTML5.
+
+Usage: python3 gen_html_entities.py [entities.json] > html_entities.cc
+
+The list is read from entities.json of the HTML5 specification
+(https://html.spec.whatwg.org/entities.json) if it is given, and taken
+from the html.entities module of Python otherwise. The output only
+depends on the list, so rerunning the script on the same list gives the
+same file.
+"""
+
+import json
+import sys
+
+HEADER = r'''/* Copyright (C) Pauli Virtanen
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *********************************************************************************/
+
+/**
+ * @file html_entities.cc
+ *
+ * The named character references of HTML5, in a perfect hash table.
+ *
+ * The table is generated from the list of the HTML5 specification
+ * (https://html.spec.whatwg.org/entities.json). Each name hashes to a
+ * bucket, and each bucket has a seed for a second hash that puts its
+ * names to free slots of the table. A lookup thus computes two hashes
+ * and compares one name.
+ *
+ * This file is generated by gen_html_entities.py: do not edit it, but
+ * rerun "python3 gen_html_entities.py [entities.json] > html_entities.cc"
+ * in the src directory.
+ */
+#include <string.h>
+
+#include "html_entities.hh"
+
+/** FNV-1a hash of [begin, end), with the given seed */
+static inline guint32 entity_hash(char const* begin, char const* end,
+				  guint32 seed)
+{
+	guint32 h = 2166136261u ^ seed;
+	for (; begin != end; ++begin) {
+		h ^= (unsigned char)*begin;
+		h *= 16777619u;
+	}
+	return h;
+}
+
+'''
+
+FOOTER = r'''HtmlEntity const* find_html_entity(char const* begin, char const* end)
+{
+	if (begin == end) return 0;
+
+	guint32 seed = seeds[entity_hash(begin, end, 0) % bucket_count];
+	HtmlEntity const* entity =
+		&entities[entity_hash(begin, end, seed) % entity_count];
+
+	size_t len = end - begin;
+	if (strncmp(entity->name, begin, len) != 0 ||
+	    entity->name[len] != '\0') return 0;
+	return entity;
+}
+'''
+
+
+def read_entities(argv):
+    """Return a map from the names with ; to their characters, and the set
+    of the legacy names also recognized without ;"""
+    if len(argv) > 1:
+        with open(argv[1]) as f:
+            data = json.load(f)
+        table = dict((k.lstrip('&'), v['characters'])
+                     for k, v in data.items())
+    else:
+        import html.entities
+        table = html.entities.html5
+    chars = dict((k.rstrip(';'), v) for k, v in table.items())
+    legacy = set(k for k in table if not k.endswith(';'))
+    return chars, legacy
+
+
+def fnv(name, seed):
+    """The FNV-1a hash of entity_hash() in the generated file"""
+    h = (2166136261 ^ seed) & 0xffffffff
+    for c in name.encode():
+        h ^= c
+        h = (h * 16777619) & 0xffffffff
+    return h
+
+
+def build_table(names):
+    """Place the names with the hash-and-displace method: the buckets are
+    placed largest first, each with the smallest seed putting its names to
+    free slots. Return the seeds and the slots."""
+    n = len(names)
+    nbuckets = (n + 1) // 2
+    buckets = [[] for _ in range(nbuckets)]
+    for name in names:
+        buckets[fnv(name, 0) % nbuckets].append(name)
+
+    slots = [None] * n
+    seeds = [0] * nbuckets
+    for b in sorted(range(nbuckets), key=lambda b: -len(buckets[b])):
+        if not buckets[b]:
+            continue
+        seed = 1
+        while True:
+            places = [fnv(name, seed) % n for name in buckets[b]]
+            if (len(set(places)) == len(places) and
+                    all(slots[i] is None for i in places)):
+                break
+            seed += 1
+        seeds[b] = seed
+        for name, i in zip(buckets[b], places):
+            slots[i] = name
+
+    assert max(seeds) < 65536 and None not in slots
+    return seeds, slots
+
+
+def main(argv):
+    chars, legacy = read_entities(argv)
+    names = sorted(chars)
+    seeds, slots = build_table(names)
+
+    out = [HEADER]
+    out.append("static unsigned int const entity_count = %d;\n" % len(slots))
+    out.append("static unsigned int const bucket_count = %d;\n\n"
+               % len(seeds))
+    out.append("/** The seeds of the second hash, indexed by the first "
+               "hash */\n")
+    out.append("static unsigned short const seeds[bucket_count] = {\n")
+    for i in range(0, len(seeds), 10):
+        out.append("\t" + ", ".join("%d" % s for s in seeds[i:i + 10])
+                   + ",\n")
+    out.append("};\n\n/** The entities, indexed by the second hash */\n")
+    out.append("static HtmlEntity const entities[entity_count] = {\n")
+    for name in slots:
+        cps = [ord(c) for c in chars[name]] + [0]
+        out.append('\t{ "%s", { 0x%X, 0x%X }, %s },\n'
+                   % (name, cps[0], cps[1],
+                      "true" if name in legacy else "false"))
+    out.append("};\n\n")
+    out.append(FOOTER)
+    sys.stdout.write("".join(out))
+
+
+if __name__ == "__main__":
+    main(sys.argv)
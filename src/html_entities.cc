@@ -0,0 +1,2304 @@
+/* Copyright (C) Pauli Virtanen
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *********************************************************************************/
+
+/**
+ * @file html_entities.cc
+ *
+ * The named character references of HTML5, in a perfect hash table.
+ *
+ * The table is generated from the list of the HTML5 specification
+ * (https://html.spec.whatwg.org/entities.json). Each name hashes to a
+ * bucket, and each bucket has a seed for a second hash that puts its
+ * names to free slots of the table. A lookup thus computes two hashes
+ * and compares one name.
+ *
+ * This file is generated by gen_html_entities.py: do not edit it, but
+ * rerun "python3 gen_html_entities.py [entities.json] > html_entities.cc"
+ * in the src directory.
+ */
+#include <string.h>
+
+#include "html_entities.hh"
+
+/** FNV-1a hash of [begin, end), with the given seed */
+static inline guint32 entity_hash(char const* begin, char const* end,
+				  guint32 seed)
+{
+	guint32 h = 2166136261u ^ seed;
+	for (; begin != end; ++begin) {
+		h ^= (unsigned char)*begin;
+		h *= 16777619u;
+	}
+	return h;
+}
+
+static unsigned int const entity_count = 2125;
+static unsigned int const bucket_count = 1063;
+
+/** The seeds of the second hash, indexed by the first hash */
+static unsigned short const seeds[bucket_count] = {
+	8, 1, 6, 26, 2, 0, 4, 6, 0, 2,
+	3, 0, 17, 1, 12, 5, 0, 1, 1, 3,
+	0, 1, 11, 2, 2, 13, 5, 2, 2, 3,
+	6, 4, 11, 3, 34, 2, 27, 4, 0, 1,
+	0, 3, 14, 1, 1, 0, 6, 9, 0, 6,
+	0, 0, 0, 12, 9, 5, 3, 1, 3, 0,
+	1, 6, 5, 5, 1, 13, 12, 6, 5, 0,
+	5, 10, 5, 0, 5, 0, 9, 15, 3, 3,
+	8, 1, 1, 3, 0, 3, 3, 2, 0, 2,
+	15, 1, 10, 1, 17, 3, 3, 9, 0, 26,
+	2, 5, 1, 8, 7, 3, 1, 8, 1, 9,
+	1, 3, 3, 28, 4, 16, 2, 21, 2, 11,
+	9, 9, 30, 9, 1, 2, 1, 0, 2, 1,
+	1, 4, 1, 7, 3, 2, 2, 2, 0, 2,
+	2, 67, 11, 70, 1, 2, 2, 2, 5, 6,
+	5, 13, 1, 1, 3, 3, 7, 8, 3, 3,
+	4, 1, 4, 2, 4, 1, 1, 17, 10, 20,
+	1, 4, 17, 12, 32, 4, 4, 0, 32, 7,
+	3, 3, 4, 13, 0, 8, 14, 1, 8, 14,
+	0, 16, 0, 15, 6, 0, 39, 1, 17, 2,
+	8, 3, 1, 2, 4, 19, 1, 6, 2, 3,
+	0, 0, 3, 3, 2, 0, 7, 3, 2, 2,
+	1, 3, 6, 0, 14, 17, 4, 12, 1, 15,
+	3, 7, 0, 11, 11, 1, 5, 64, 2, 25,
+	34, 69, 21, 1, 7, 11, 11, 1, 2, 0,
+	16, 1, 27, 12, 2, 0, 32, 1, 19, 4,
+	13, 22, 3, 0, 12, 0, 9, 2, 2, 30,
+	57, 3, 0, 8, 2, 1, 0, 9, 0, 2,
+	1, 3, 0, 161, 36, 0, 74, 8, 72, 1,
+	1, 8, 1, 25, 3, 2, 0, 18, 4, 0,
+	29, 13, 6, 0, 0, 2, 26, 143, 2, 20,
+	7, 4, 0, 0, 1, 3, 45, 50, 3, 3,
+	0, 5, 0, 8, 0, 6, 0, 4, 16, 2,
+	3, 0, 18, 0, 3, 2, 3, 5, 0, 18,
+	5, 1, 4, 4, 6, 2, 0, 2, 0, 0,
+	83, 7, 1, 88, 30, 22, 4, 0, 64, 2,
+	4, 14, 3, 24, 57, 0, 32, 1, 26, 13,
+	3, 8, 4, 9, 19, 1, 2, 0, 43, 20,
+	16, 10, 18, 1, 0, 0, 11, 13, 8, 5,
+	95, 4, 1, 8, 1, 10, 0, 90, 14, 4,
+	1, 1, 11, 1, 1, 1, 5, 6, 20, 2,
+	9, 8, 24, 16, 0, 0, 8, 28, 11, 69,
+	4, 0, 2, 132, 2, 85, 62, 6, 4, 7,
+	0, 12, 0, 29, 0, 5, 1, 0, 0, 22,
+	10, 0, 130, 71, 8, 1, 13, 12, 1, 128,
+	8, 21, 4, 0, 4, 4, 0, 0, 2, 15,
+	18, 6, 29, 2, 22, 1, 9, 4, 2, 14,
+	0, 9, 3, 6, 1, 2, 11, 1, 4, 11,
+	15, 1, 1, 0, 9, 13, 28, 1, 11, 2,
+	3, 27, 2, 3, 9, 21, 6, 8, 1, 5,
+	1, 7, 0, 0, 13, 6, 7, 4, 1, 95,
+	4, 4, 0, 1, 23, 64, 1, 19, 17, 4,
+	2, 0, 0, 1, 1, 4, 25, 15, 28, 1,
+	0, 1, 6, 1, 20, 2, 26, 43, 24, 23,
+	24, 58, 16, 21, 3, 65, 76, 4, 1, 1,
+	15, 1, 4, 0, 2, 1, 6, 41, 34, 10,
+	70, 11, 0, 14, 33, 14, 18, 12, 1, 15,
+	76, 18, 72, 36, 12, 1, 0, 8, 65, 182,
+	89, 9, 16, 29, 2, 31, 8, 14, 35, 103,
+	1, 14, 7, 11, 1, 19, 4, 40, 1, 36,
+	154, 7, 3, 1, 0, 4, 0, 30, 7, 28,
+	14, 13, 15, 135, 3, 43, 10, 1, 9, 3,
+	23, 10, 7, 4, 5, 0, 25, 14, 82, 2,
+	6, 15, 5, 90, 12, 0, 13, 0, 8, 8,
+	49, 1, 27, 21, 4, 17, 9, 1, 0, 2,
+	4, 6, 73, 17, 27, 1, 17, 16, 2, 42,
+	13, 12, 71, 23, 7, 41, 5, 18, 6, 5,
+	0, 23, 20, 3, 133, 1, 47, 4, 2, 40,
+	1, 0, 1, 0, 40, 1, 0, 15, 5, 2,
+	12, 0, 83, 5, 20, 1, 41, 0, 14, 3,
+	1, 76, 2, 20, 24, 1, 32, 3, 89, 1,
+	13, 11, 10, 0, 1, 3, 12, 102, 4, 30,
+	1, 0, 1, 3, 16, 1, 1, 51, 78, 66,
+	91, 0, 4, 10, 1, 28, 1, 1, 116, 0,
+	2, 0, 5, 29, 4, 11, 27, 15, 32, 78,
+	14, 56, 5, 119, 38, 5, 3, 67, 82, 48,
+	0, 0, 9, 2, 65, 9, 4, 50, 74, 0,
+	0, 4, 0, 8, 6, 96, 1, 2, 90, 2,
+	47, 58, 91, 25, 27, 4, 6, 12, 72, 2,
+	6, 14, 0, 3, 31, 8, 71, 1, 13, 18,
+	6, 0, 7, 13, 149, 101, 0, 10, 8, 10,
+	0, 38, 1, 17, 2, 89, 27, 0, 45, 24,
+	33, 1, 18, 31, 2, 0, 114, 0, 4, 16,
+	4, 9, 0, 32, 14, 1, 5, 36, 0, 0,
+	24, 0, 4, 119, 29, 3, 4, 22, 0, 23,
+	22, 5, 98, 1, 11, 0, 4, 11, 15, 16,
+	60, 4, 6, 58, 1, 18, 4, 2, 0, 55,
+	14, 20, 22, 21, 133, 86, 101, 1, 38, 69,
+	0, 7, 1, 4, 48, 3, 0, 0, 34, 25,
+	0, 2, 78, 3, 86, 67, 26, 30, 0, 2,
+	130, 2, 1, 30, 0, 12, 5, 43, 40, 273,
+	53, 1, 51, 30, 50, 20, 23, 10, 0, 173,
+	10, 53, 110, 163, 32, 61, 0, 20, 4, 10,
+	11, 10, 151, 0, 13, 21, 96, 203, 0, 39,
+	0, 110, 1, 1, 45, 23, 16, 9, 0, 247,
+	10, 396, 140, 5, 5, 25, 1, 118, 86, 23,
+	12, 0, 0, 0, 1, 0, 478, 78, 341, 1,
+	22, 3, 29, 12, 37, 137, 12, 72, 113, 1,
+	1, 13, 44, 320, 14, 265, 0, 7, 11, 52,
+	34, 10, 6, 204, 9, 246, 14, 4, 49, 30,
+	1, 31, 8, 0, 37, 6, 4, 179, 13, 2,
+	20, 198, 28, 3, 7, 19, 2, 77, 48, 17,
+	11, 2, 284, 30, 3, 0, 4, 0, 21, 119,
+	114, 1019, 8, 29, 0, 161, 5, 88, 5, 0,
+	269, 191, 1398, 14, 18, 179, 50, 41, 97, 0,
+	13, 1, 0, 0, 229, 10, 1347, 3, 932, 5951,
+	9, 91, 19,
+};
+
+/** The entities, indexed by the second hash */
+static HtmlEntity const entities[entity_count] = {
+	{ "lne", { 0x2A87, 0x0 }, false },
+	{ "dscr", { 0x1D4B9, 0x0 }, false },
+	{ "nlarr", { 0x219A, 0x0 }, false },
+	{ "SquareIntersection", { 0x2293, 0x0 }, false },
+	{ "oS", { 0x24C8, 0x0 }, false },
+	{ "Uarrocir", { 0x2949, 0x0 }, false },
+	{ "NotGreaterTilde", { 0x2275, 0x0 }, false },
+	{ "Therefore", { 0x2234, 0x0 }, false },
+	{ "gnap", { 0x2A8A, 0x0 }, false },
+	{ "csupe", { 0x2AD2, 0x0 }, false },
+	{ "osol", { 0x2298, 0x0 }, false },
+	{ "Element", { 0x2208, 0x0 }, false },
+	{ "ratail", { 0x291A, 0x0 }, false },
+	{ "ifr", { 0x1D526, 0x0 }, false },
+	{ "lbrksld", { 0x298F, 0x0 }, false },
+	{ "angmsdae", { 0x29AC, 0x0 }, false },
+	{ "ohm", { 0x3A9, 0x0 }, false },
+	{ "lat", { 0x2AAB, 0x0 }, false },
+	{ "Hcirc", { 0x124, 0x0 }, false },
+	{ "pluse", { 0x2A72, 0x0 }, false },
+	{ "range", { 0x29A5, 0x0 }, false },
+	{ "scE", { 0x2AB4, 0x0 }, false },
+	{ "weierp", { 0x2118, 0x0 }, false },
+	{ "diam", { 0x22C4, 0x0 }, false },
+	{ "NonBreakingSpace", { 0xA0, 0x0 }, false },
+	{ "lnE", { 0x2268, 0x0 }, false },
+	{ "geq", { 0x2265, 0x0 }, false },
+	{ "sacute", { 0x15B, 0x0 }, false },
+	{ "Eopf", { 0x1D53C, 0x0 }, false },
+	{ "forkv", { 0x2AD9, 0x0 }, false },
+	{ "YAcy", { 0x42F, 0x0 }, false },
+	{ "rAtail", { 0x291C, 0x0 }, false },
+	{ "ntlg", { 0x2278, 0x0 }, false },
+	{ "Supset", { 0x22D1, 0x0 }, false },
+	{ "Vcy", { 0x412, 0x0 }, false },
+	{ "cupdot", { 0x228D, 0x0 }, false },
+	{ "gnsim", { 0x22E7, 0x0 }, false },
+	{ "odsold", { 0x29BC, 0x0 }, false },
+	{ "nwarhk", { 0x2923, 0x0 }, false },
+	{ "die", { 0xA8, 0x0 }, false },
+	{ "nfr", { 0x1D52B, 0x0 }, false },
+	{ "tint", { 0x222D, 0x0 }, false },
+	{ "SquareSubsetEqual", { 0x2291, 0x0 }, false },
+	{ "Odblac", { 0x150, 0x0 }, false },
+	{ "Qscr", { 0x1D4AC, 0x0 }, false },
+	{ "lsh", { 0x21B0, 0x0 }, false },
+	{ "copysr", { 0x2117, 0x0 }, false },
+	{ "Ecaron", { 0x11A, 0x0 }, false },
+	{ "bumpe", { 0x224F, 0x0 }, false },
+	{ "subsetneq", { 0x228A, 0x0 }, false },
+	{ "becaus", { 0x2235, 0x0 }, false },
+	{ "phone", { 0x260E, 0x0 }, false },
+	{ "UnderBar", { 0x5F, 0x0 }, false },
+	{ "blacktriangleright", { 0x25B8, 0x0 }, false },
+	{ "omid", { 0x29B6, 0x0 }, false },
+	{ "rbarr", { 0x290D, 0x0 }, false },
+	{ "rcaron", { 0x159, 0x0 }, false },
+	{ "plusdu", { 0x2A25, 0x0 }, false },
+	{ "alpha", { 0x3B1, 0x0 }, false },
+	{ "larrtl", { 0x21A2, 0x0 }, false },
+	{ "plusb", { 0x229E, 0x0 }, false },
+	{ "gap", { 0x2A86, 0x0 }, false },
+	{ "Lopf", { 0x1D543, 0x0 }, false },
+	{ "rarrw", { 0x219D, 0x0 }, false },
+	{ "Intersection", { 0x22C2, 0x0 }, false },
+	{ "ljcy", { 0x459, 0x0 }, false },
+	{ "gcy", { 0x433, 0x0 }, false },
+	{ "eta", { 0x3B7, 0x0 }, false },
+	{ "pitchfork", { 0x22D4, 0x0 }, false },
+	{ "supsim", { 0x2AC8, 0x0 }, false },
+	{ "omicron", { 0x3BF, 0x0 }, false },
+	{ "nsupseteq", { 0x2289, 0x0 }, false },
+	{ "hslash", { 0x210F, 0x0 }, false },
+	{ "Rscr", { 0x211B, 0x0 }, false },
+	{ "SucceedsSlantEqual", { 0x227D, 0x0 }, false },
+	{ "ord", { 0x2A5D, 0x0 }, false },
+	{ "Bernoullis", { 0x212C, 0x0 }, false },
+	{ "num", { 0x23, 0x0 }, false },
+	{ "Congruent", { 0x2261, 0x0 }, false },
+	{ "NotGreaterEqual", { 0x2271, 0x0 }, false },
+	{ "Amacr", { 0x100, 0x0 }, false },
+	{ "Ncaron", { 0x147, 0x0 }, false },
+	{ "ccedil", { 0xE7, 0x0 }, true },
+	{ "olcross", { 0x29BB, 0x0 }, false },
+	{ "andand", { 0x2A55, 0x0 }, false },
+	{ "toea", { 0x2928, 0x0 }, false },
+	{ "cularr", { 0x21B6, 0x0 }, false },
+	{ "ngt", { 0x226F, 0x0 }, false },
+	{ "alefsym", { 0x2135, 0x0 }, false },
+	{ "niv", { 0x220B, 0x0 }, false },
+	{ "zopf", { 0x1D56B, 0x0 }, false },
+	{ "Wscr", { 0x1D4B2, 0x0 }, false },
+	{ "Wedge", { 0x22C0, 0x0 }, false },
+	{ "subnE", { 0x2ACB, 0x0 }, false },
+	{ "DiacriticalGrave", { 0x60, 0x0 }, false },
+	{ "orslope", { 0x2A57, 0x0 }, false },
+	{ "upharpoonright", { 0x21BE, 0x0 }, false },
+	{ "nvge", { 0x2265, 0x20D2 }, false },
+	{ "olcir", { 0x29BE, 0x0 }, false },
+	{ "boxtimes", { 0x22A0, 0x0 }, false },
+	{ "hellip", { 0x2026, 0x0 }, false },
+	{ "lharu", { 0x21BC, 0x0 }, false },
+	{ "Lleftarrow", { 0x21DA, 0x0 }, false },
+	{ "subset", { 0x2282, 0x0 }, false },
+	{ "Sub", { 0x22D0, 0x0 }, false },
+	{ "dash", { 0x2010, 0x0 }, false },
+	{ "radic", { 0x221A, 0x0 }, false },
+	{ "supseteq", { 0x2287, 0x0 }, false },
+	{ "acirc", { 0xE2, 0x0 }, true },
+	{ "lesseqqgtr", { 0x2A8B, 0x0 }, false },
+	{ "egsdot", { 0x2A98, 0x0 }, false },
+	{ "bsim", { 0x223D, 0x0 }, false },
+	{ "setminus", { 0x2216, 0x0 }, false },
+	{ "bbrktbrk", { 0x23B6, 0x0 }, false },
+	{ "bepsi", { 0x3F6, 0x0 }, false },
+	{ "Uarr", { 0x219F, 0x0 }, false },
+	{ "diamond", { 0x22C4, 0x0 }, false },
+	{ "TildeTilde", { 0x2248, 0x0 }, false },
+	{ "sc", { 0x227B, 0x0 }, false },
+	{ "ogon", { 0x2DB, 0x0 }, false },
+	{ "UpArrow", { 0x2191, 0x0 }, false },
+	{ "beta", { 0x3B2, 0x0 }, false },
+	{ "Dagger", { 0x2021, 0x0 }, false },
+	{ "cirmid", { 0x2AEF, 0x0 }, false },
+	{ "nu", { 0x3BD, 0x0 }, false },
+	{ "ffr", { 0x1D523, 0x0 }, false },
+	{ "Ufr", { 0x1D518, 0x0 }, false },
+	{ "lsquo", { 0x2018, 0x0 }, false },
+	{ "cirfnint", { 0x2A10, 0x0 }, false },
+	{ "Poincareplane", { 0x210C, 0x0 }, false },
+	{ "Psi", { 0x3A8, 0x0 }, false },
+	{ "nbsp", { 0xA0, 0x0 }, true },
+	{ "nsmid", { 0x2224, 0x0 }, false },
+	{ "nvDash", { 0x22AD, 0x0 }, false },
+	{ "LowerRightArrow", { 0x2198, 0x0 }, false },
+	{ "icy", { 0x438, 0x0 }, false },
+	{ "divideontimes", { 0x22C7, 0x0 }, false },
+	{ "Ll", { 0x22D8, 0x0 }, false },
+	{ "acute", { 0xB4, 0x0 }, true },
+	{ "clubsuit", { 0x2663, 0x0 }, false },
+	{ "isindot", { 0x22F5, 0x0 }, false },
+	{ "parsl", { 0x2AFD, 0x0 }, false },
+	{ "NotEqualTilde", { 0x2242, 0x338 }, false },
+	{ "NotGreaterGreater", { 0x226B, 0x338 }, false },
+	{ "fltns", { 0x25B1, 0x0 }, false },
+	{ "backprime", { 0x2035, 0x0 }, false },
+	{ "vBarv", { 0x2AE9, 0x0 }, false },
+	{ "Zcaron", { 0x17D, 0x0 }, false },
+	{ "Esim", { 0x2A73, 0x0 }, false },
+	{ "Sopf", { 0x1D54A, 0x0 }, false },
+	{ "seswar", { 0x2929, 0x0 }, false },
+	{ "ropf", { 0x1D563, 0x0 }, false },
+	{ "notinvc", { 0x22F6, 0x0 }, false },
+	{ "lfr", { 0x1D529, 0x0 }, false },
+	{ "topbot", { 0x2336, 0x0 }, false },
+	{ "approxeq", { 0x224A, 0x0 }, false },
+	{ "fork", { 0x22D4, 0x0 }, false },
+	{ "capand", { 0x2A44, 0x0 }, false },
+	{ "vnsup", { 0x2283, 0x20D2 }, false },
+	{ "nlt", { 0x226E, 0x0 }, false },
+	{ "NotLessLess", { 0x226A, 0x338 }, false },
+	{ "nLeftrightarrow", { 0x21CE, 0x0 }, false },
+	{ "NotNestedGreaterGreater", { 0x2AA2, 0x338 }, false },
+	{ "Bopf", { 0x1D539, 0x0 }, false },
+	{ "rtri", { 0x25B9, 0x0 }, false },
+	{ "nVdash", { 0x22AE, 0x0 }, false },
+	{ "lessapprox", { 0x2A85, 0x0 }, false },
+	{ "LeftFloor", { 0x230A, 0x0 }, false },
+	{ "nrtrie", { 0x22ED, 0x0 }, false },
+	{ "check", { 0x2713, 0x0 }, false },
+	{ "apid", { 0x224B, 0x0 }, false },
+	{ "nles", { 0x2A7D, 0x338 }, false },
+	{ "rfisht", { 0x297D, 0x0 }, false },
+	{ "twixt", { 0x226C, 0x0 }, false },
+	{ "cfr", { 0x1D520, 0x0 }, false },
+	{ "MinusPlus", { 0x2213, 0x0 }, false },
+	{ "dlcrop", { 0x230D, 0x0 }, false },
+	{ "Rightarrow", { 0x21D2, 0x0 }, false },
+	{ "Nacute", { 0x143, 0x0 }, false },
+	{ "frac12", { 0xBD, 0x0 }, true },
+	{ "latail", { 0x2919, 0x0 }, false },
+	{ "ntrianglelefteq", { 0x22EC, 0x0 }, false },
+	{ "ntrianglerighteq", { 0x22ED, 0x0 }, false },
+	{ "frac35", { 0x2157, 0x0 }, false },
+	{ "CloseCurlyQuote", { 0x2019, 0x0 }, false },
+	{ "YUcy", { 0x42E, 0x0 }, false },
+	{ "lmidot", { 0x140, 0x0 }, false },
+	{ "frac23", { 0x2154, 0x0 }, false },
+	{ "fcy", { 0x444, 0x0 }, false },
+	{ "isinv", { 0x2208, 0x0 }, false },
+	{ "NegativeVeryThinSpace", { 0x200B, 0x0 }, false },
+	{ "varr", { 0x2195, 0x0 }, false },
+	{ "Tcedil", { 0x162, 0x0 }, false },
+	{ "Lstrok", { 0x141, 0x0 }, false },
+	{ "ltcc", { 0x2AA6, 0x0 }, false },
+	{ "RightTee", { 0x22A2, 0x0 }, false },
+	{ "VerticalBar", { 0x2223, 0x0 }, false },
+	{ "Lscr", { 0x2112, 0x0 }, false },
+	{ "jukcy", { 0x454, 0x0 }, false },
+	{ "Mcy", { 0x41C, 0x0 }, false },
+	{ "el", { 0x2A99, 0x0 }, false },
+	{ "NotTildeFullEqual", { 0x2247, 0x0 }, false },
+	{ "NegativeThinSpace", { 0x200B, 0x0 }, false },
+	{ "cacute", { 0x107, 0x0 }, false },
+	{ "Ncy", { 0x41D, 0x0 }, false },
+	{ "perp", { 0x22A5, 0x0 }, false },
+	{ "xi", { 0x3BE, 0x0 }, false },
+	{ "ntilde", { 0xF1, 0x0 }, true },
+	{ "lbrkslu", { 0x298D, 0x0 }, false },
+	{ "downarrow", { 0x2193, 0x0 }, false },
+	{ "ldrushar", { 0x294B, 0x0 }, false },
+	{ "utdot", { 0x22F0, 0x0 }, false },
+	{ "topf", { 0x1D565, 0x0 }, false },
+	{ "shortmid", { 0x2223, 0x0 }, false },
+	{ "QUOT", { 0x22, 0x0 }, true },
+	{ "boxDL", { 0x2557, 0x0 }, false },
+	{ "NotTilde", { 0x2241, 0x0 }, false },
+	{ "HumpEqual", { 0x224F, 0x0 }, false },
+	{ "squ", { 0x25A1, 0x0 }, false },
+	{ "notindot", { 0x22F5, 0x338 }, false },
+	{ "compfn", { 0x2218, 0x0 }, false },
+	{ "Ucy", { 0x423, 0x0 }, false },
+	{ "boxvH", { 0x256A, 0x0 }, false },
+	{ "zhcy", { 0x436, 0x0 }, false },
+	{ "boxminus", { 0x229F, 0x0 }, false },
+	{ "MediumSpace", { 0x205F, 0x0 }, false },
+	{ "Acy", { 0x410, 0x0 }, false },
+	{ "bemptyv", { 0x29B0, 0x0 }, false },
+	{ "sup3", { 0xB3, 0x0 }, true },
+	{ "gvertneqq", { 0x2269, 0xFE00 }, false },
+	{ "igrave", { 0xEC, 0x0 }, true },
+	{ "ordm", { 0xBA, 0x0 }, true },
+	{ "ZeroWidthSpace", { 0x200B, 0x0 }, false },
+	{ "intlarhk", { 0x2A17, 0x0 }, false },
+	{ "langd", { 0x2991, 0x0 }, false },
+	{ "udarr", { 0x21C5, 0x0 }, false },
+	{ "int", { 0x222B, 0x0 }, false },
+	{ "gtquest", { 0x2A7C, 0x0 }, false },
+	{ "xuplus", { 0x2A04, 0x0 }, false },
+	{ "top", { 0x22A4, 0x0 }, false },
+	{ "scedil", { 0x15F, 0x0 }, false },
+	{ "NotExists", { 0x2204, 0x0 }, false },
+	{ "omacr", { 0x14D, 0x0 }, false },
+	{ "andv", { 0x2A5A, 0x0 }, false },
+	{ "nwnear", { 0x2927, 0x0 }, false },
+	{ "Ascr", { 0x1D49C, 0x0 }, false },
+	{ "triangleq", { 0x225C, 0x0 }, false },
+	{ "Udblac", { 0x170, 0x0 }, false },
+	{ "seArr", { 0x21D8, 0x0 }, false },
+	{ "nabla", { 0x2207, 0x0 }, false },
+	{ "omega", { 0x3C9, 0x0 }, false },
+	{ "uharr", { 0x21BE, 0x0 }, false },
+	{ "lrarr", { 0x21C6, 0x0 }, false },
+	{ "upharpoonleft", { 0x21BF, 0x0 }, false },
+	{ "ltri", { 0x25C3, 0x0 }, false },
+	{ "aacute", { 0xE1, 0x0 }, true },
+	{ "NotSubset", { 0x2282, 0x20D2 }, false },
+	{ "numero", { 0x2116, 0x0 }, false },
+	{ "supne", { 0x228B, 0x0 }, false },
+	{ "triminus", { 0x2A3A, 0x0 }, false },
+	{ "subE", { 0x2AC5, 0x0 }, false },
+	{ "EmptyVerySmallSquare", { 0x25AB, 0x0 }, false },
+	{ "Tab", { 0x9, 0x0 }, false },
+	{ "AElig", { 0xC6, 0x0 }, true },
+	{ "oline", { 0x203E, 0x0 }, false },
+	{ "xdtri", { 0x25BD, 0x0 }, false },
+	{ "harrcir", { 0x2948, 0x0 }, false },
+	{ "rsquo", { 0x2019, 0x0 }, false },
+	{ "rcub", { 0x7D, 0x0 }, false },
+	{ "frac14", { 0xBC, 0x0 }, true },
+	{ "Ccedil", { 0xC7, 0x0 }, true },
+	{ "Mfr", { 0x1D510, 0x0 }, false },
+	{ "NotEqual", { 0x2260, 0x0 }, false },
+	{ "Sc", { 0x2ABC, 0x0 }, false },
+	{ "RightVector", { 0x21C0, 0x0 }, false },
+	{ "vscr", { 0x1D4CB, 0x0 }, false },
+	{ "Dstrok", { 0x110, 0x0 }, false },
+	{ "NotHumpEqual", { 0x224F, 0x338 }, false },
+	{ "Qfr", { 0x1D514, 0x0 }, false },
+	{ "dlcorn", { 0x231E, 0x0 }, false },
+	{ "RightFloor", { 0x230B, 0x0 }, false },
+	{ "boxHU", { 0x2569, 0x0 }, false },
+	{ "LeftArrowBar", { 0x21E4, 0x0 }, false },
+	{ "supE", { 0x2AC6, 0x0 }, false },
+	{ "tcy", { 0x442, 0x0 }, false },
+	{ "dzcy", { 0x45F, 0x0 }, false },
+	{ "ucirc", { 0xFB, 0x0 }, true },
+	{ "boxVH", { 0x256C, 0x0 }, false },
+	{ "scap", { 0x2AB8, 0x0 }, false },
+	{ "vsubne", { 0x228A, 0xFE00 }, false },
+	{ "gesl", { 0x22DB, 0xFE00 }, false },
+	{ "LeftUpTeeVector", { 0x2960, 0x0 }, false },
+	{ "parsim", { 0x2AF3, 0x0 }, false },
+	{ "longmapsto", { 0x27FC, 0x0 }, false },
+	{ "atilde", { 0xE3, 0x0 }, true },
+	{ "gtrsim", { 0x2273, 0x0 }, false },
+	{ "searr", { 0x2198, 0x0 }, false },
+	{ "DoubleUpDownArrow", { 0x21D5, 0x0 }, false },
+	{ "pertenk", { 0x2031, 0x0 }, false },
+	{ "Rho", { 0x3A1, 0x0 }, false },
+	{ "nsqsube", { 0x22E2, 0x0 }, false },
+	{ "precnapprox", { 0x2AB9, 0x0 }, false },
+	{ "precneqq", { 0x2AB5, 0x0 }, false },
+	{ "cudarrr", { 0x2935, 0x0 }, false },
+	{ "downdownarrows", { 0x21CA, 0x0 }, false },
+	{ "lthree", { 0x22CB, 0x0 }, false },
+	{ "SucceedsEqual", { 0x2AB0, 0x0 }, false },
+	{ "reg", { 0xAE, 0x0 }, true },
+	{ "lg", { 0x2276, 0x0 }, false },
+	{ "sim", { 0x223C, 0x0 }, false },
+	{ "curlyeqsucc", { 0x22DF, 0x0 }, false },
+	{ "Fopf", { 0x1D53D, 0x0 }, false },
+	{ "swarhk", { 0x2926, 0x0 }, false },
+	{ "DoubleLeftRightArrow", { 0x21D4, 0x0 }, false },
+	{ "Pfr", { 0x1D513, 0x0 }, false },
+	{ "or", { 0x2228, 0x0 }, false },
+	{ "frac38", { 0x215C, 0x0 }, false },
+	{ "lacute", { 0x13A, 0x0 }, false },
+	{ "downharpoonright", { 0x21C2, 0x0 }, false },
+	{ "Bcy", { 0x411, 0x0 }, false },
+	{ "vBar", { 0x2AE8, 0x0 }, false },
+	{ "NewLine", { 0xA, 0x0 }, false },
+	{ "minus", { 0x2212, 0x0 }, false },
+	{ "RBarr", { 0x2910, 0x0 }, false },
+	{ "nexists", { 0x2204, 0x0 }, false },
+	{ "olarr", { 0x21BA, 0x0 }, false },
+	{ "blank", { 0x2423, 0x0 }, false },
+	{ "bull", { 0x2022, 0x0 }, false },
+	{ "Otilde", { 0xD5, 0x0 }, true },
+	{ "ctdot", { 0x22EF, 0x0 }, false },
+	{ "imof", { 0x22B7, 0x0 }, false },
+	{ "primes", { 0x2119, 0x0 }, false },
+	{ "lesdotor", { 0x2A83, 0x0 }, false },
+	{ "circleddash", { 0x229D, 0x0 }, false },
+	{ "risingdotseq", { 0x2253, 0x0 }, false },
+	{ "rscr", { 0x1D4C7, 0x0 }, false },
+	{ "lcub", { 0x7B, 0x0 }, false },
+	{ "GJcy", { 0x403, 0x0 }, false },
+	{ "EmptySmallSquare", { 0x25FB, 0x0 }, false },
+	{ "lAtail", { 0x291B, 0x0 }, false },
+	{ "fjlig", { 0x66, 0x6A }, false },
+	{ "Itilde", { 0x128, 0x0 }, false },
+	{ "DownRightTeeVector", { 0x295F, 0x0 }, false },
+	{ "ccirc", { 0x109, 0x0 }, false },
+	{ "supsup", { 0x2AD6, 0x0 }, false },
+	{ "emptyv", { 0x2205, 0x0 }, false },
+	{ "slarr", { 0x2190, 0x0 }, false },
+	{ "lrcorner", { 0x231F, 0x0 }, false },
+	{ "nrtri", { 0x22EB, 0x0 }, false },
+	{ "rsaquo", { 0x203A, 0x0 }, false },
+	{ "prap", { 0x2AB7, 0x0 }, false },
+	{ "sext", { 0x2736, 0x0 }, false },
+	{ "gfr", { 0x1D524, 0x0 }, false },
+	{ "kappa", { 0x3BA, 0x0 }, false },
+	{ "glE", { 0x2A92, 0x0 }, false },
+	{ "solb", { 0x29C4, 0x0 }, false },
+	{ "sqcaps", { 0x2293, 0xFE00 }, false },
+	{ "PrecedesSlantEqual", { 0x227C, 0x0 }, false },
+	{ "rightarrowtail", { 0x21A3, 0x0 }, false },
+	{ "notniva", { 0x220C, 0x0 }, false },
+	{ "star", { 0x2606, 0x0 }, false },
+	{ "jfr", { 0x1D527, 0x0 }, false },
+	{ "smeparsl", { 0x29E4, 0x0 }, false },
+	{ "nsce", { 0x2AB0, 0x338 }, false },
+	{ "swnwar", { 0x292A, 0x0 }, false },
+	{ "lBarr", { 0x290E, 0x0 }, false },
+	{ "cupor", { 0x2A45, 0x0 }, false },
+	{ "bigcirc", { 0x25EF, 0x0 }, false },
+	{ "hksearow", { 0x2925, 0x0 }, false },
+	{ "Phi", { 0x3A6, 0x0 }, false },
+	{ "TripleDot", { 0x20DB, 0x0 }, false },
+	{ "boxVr", { 0x255F, 0x0 }, false },
+	{ "upsih", { 0x3D2, 0x0 }, false },
+	{ "gtrless", { 0x2277, 0x0 }, false },
+	{ "swarr", { 0x2199, 0x0 }, false },
+	{ "dotplus", { 0x2214, 0x0 }, false },
+	{ "nRightarrow", { 0x21CF, 0x0 }, false },
+	{ "Product", { 0x220F, 0x0 }, false },
+	{ "dtri", { 0x25BF, 0x0 }, false },
+	{ "div", { 0xF7, 0x0 }, false },
+	{ "angmsd", { 0x2221, 0x0 }, false },
+	{ "Jukcy", { 0x404, 0x0 }, false },
+	{ "prod", { 0x220F, 0x0 }, false },
+	{ "Zcy", { 0x417, 0x0 }, false },
+	{ "eDDot", { 0x2A77, 0x0 }, false },
+	{ "eg", { 0x2A9A, 0x0 }, false },
+	{ "ang", { 0x2220, 0x0 }, false },
+	{ "RightArrowLeftArrow", { 0x21C4, 0x0 }, false },
+	{ "RoundImplies", { 0x2970, 0x0 }, false },
+	{ "cedil", { 0xB8, 0x0 }, true },
+	{ "Cscr", { 0x1D49E, 0x0 }, false },
+	{ "loarr", { 0x21FD, 0x0 }, false },
+	{ "angzarr", { 0x237C, 0x0 }, false },
+	{ "RightVectorBar", { 0x2953, 0x0 }, false },
+	{ "rfr", { 0x1D52F, 0x0 }, false },
+	{ "ecirc", { 0xEA, 0x0 }, true },
+	{ "leg", { 0x22DA, 0x0 }, false },
+	{ "rBarr", { 0x290F, 0x0 }, false },
+	{ "rarrbfs", { 0x2920, 0x0 }, false },
+	{ "expectation", { 0x2130, 0x0 }, false },
+	{ "aleph", { 0x2135, 0x0 }, false },
+	{ "boxVL", { 0x2563, 0x0 }, false },
+	{ "mopf", { 0x1D55E, 0x0 }, false },
+	{ "doteqdot", { 0x2251, 0x0 }, false },
+	{ "curvearrowleft", { 0x21B6, 0x0 }, false },
+	{ "Map", { 0x2905, 0x0 }, false },
+	{ "KHcy", { 0x425, 0x0 }, false },
+	{ "gacute", { 0x1F5, 0x0 }, false },
+	{ "divide", { 0xF7, 0x0 }, true },
+	{ "circledS", { 0x24C8, 0x0 }, false },
+	{ "lsqb", { 0x5B, 0x0 }, false },
+	{ "yscr", { 0x1D4CE, 0x0 }, false },
+	{ "backepsilon", { 0x3F6, 0x0 }, false },
+	{ "NestedLessLess", { 0x226A, 0x0 }, false },
+	{ "nle", { 0x2270, 0x0 }, false },
+	{ "rlhar", { 0x21CC, 0x0 }, false },
+	{ "capcap", { 0x2A4B, 0x0 }, false },
+	{ "phi", { 0x3C6, 0x0 }, false },
+	{ "RightUpTeeVector", { 0x295C, 0x0 }, false },
+	{ "gsime", { 0x2A8E, 0x0 }, false },
+	{ "nvrArr", { 0x2903, 0x0 }, false },
+	{ "succneqq", { 0x2AB6, 0x0 }, false },
+	{ "Barv", { 0x2AE7, 0x0 }, false },
+	{ "nang", { 0x2220, 0x20D2 }, false },
+	{ "trie", { 0x225C, 0x0 }, false },
+	{ "VeryThinSpace", { 0x200A, 0x0 }, false },
+	{ "lvnE", { 0x2268, 0xFE00 }, false },
+	{ "Uopf", { 0x1D54C, 0x0 }, false },
+	{ "Kfr", { 0x1D50E, 0x0 }, false },
+	{ "OpenCurlyDoubleQuote", { 0x201C, 0x0 }, false },
+	{ "Kopf", { 0x1D542, 0x0 }, false },
+	{ "gtrdot", { 0x22D7, 0x0 }, false },
+	{ "angmsdaa", { 0x29A8, 0x0 }, false },
+	{ "Proportion", { 0x2237, 0x0 }, false },
+	{ "napE", { 0x2A70, 0x338 }, false },
+	{ "bsemi", { 0x204F, 0x0 }, false },
+	{ "eacute", { 0xE9, 0x0 }, true },
+	{ "bprime", { 0x2035, 0x0 }, false },
+	{ "ldquo", { 0x201C, 0x0 }, false },
+	{ "Kcy", { 0x41A, 0x0 }, false },
+	{ "erarr", { 0x2971, 0x0 }, false },
+	{ "ges", { 0x2A7E, 0x0 }, false },
+	{ "mstpos", { 0x223E, 0x0 }, false },
+	{ "nsime", { 0x2244, 0x0 }, false },
+	{ "blacksquare", { 0x25AA, 0x0 }, false },
+	{ "suplarr", { 0x297B, 0x0 }, false },
+	{ "equals", { 0x3D, 0x0 }, false },
+	{ "spades", { 0x2660, 0x0 }, false },
+	{ "xvee", { 0x22C1, 0x0 }, false },
+	{ "lescc", { 0x2AA8, 0x0 }, false },
+	{ "ltimes", { 0x22C9, 0x0 }, false },
+	{ "sqsubseteq", { 0x2291, 0x0 }, false },
+	{ "LeftDownVector", { 0x21C3, 0x0 }, false },
+	{ "Gg", { 0x22D9, 0x0 }, false },
+	{ "ruluhar", { 0x2968, 0x0 }, false },
+	{ "lfisht", { 0x297C, 0x0 }, false },
+	{ "khcy", { 0x445, 0x0 }, false },
+	{ "roarr", { 0x21FE, 0x0 }, false },
+	{ "DownTee", { 0x22A4, 0x0 }, false },
+	{ "Gcirc", { 0x11C, 0x0 }, false },
+	{ "lnapprox", { 0x2A89, 0x0 }, false },
+	{ "ijlig", { 0x133, 0x0 }, false },
+	{ "NotLess", { 0x226E, 0x0 }, false },
+	{ "csup", { 0x2AD0, 0x0 }, false },
+	{ "DoubleRightArrow", { 0x21D2, 0x0 }, false },
+	{ "laquo", { 0xAB, 0x0 }, true },
+	{ "GreaterFullEqual", { 0x2267, 0x0 }, false },
+	{ "acd", { 0x223F, 0x0 }, false },
+	{ "Egrave", { 0xC8, 0x0 }, true },
+	{ "gesdot", { 0x2A80, 0x0 }, false },
+	{ "dsol", { 0x29F6, 0x0 }, false },
+	{ "Cacute", { 0x106, 0x0 }, false },
+	{ "multimap", { 0x22B8, 0x0 }, false },
+	{ "searhk", { 0x2925, 0x0 }, false },
+	{ "CircleDot", { 0x2299, 0x0 }, false },
+	{ "lEg", { 0x2A8B, 0x0 }, false },
+	{ "easter", { 0x2A6E, 0x0 }, false },
+	{ "leftrightharpoons", { 0x21CB, 0x0 }, false },
+	{ "HumpDownHump", { 0x224E, 0x0 }, false },
+	{ "conint", { 0x222E, 0x0 }, false },
+	{ "laemptyv", { 0x29B4, 0x0 }, false },
+	{ "quatint", { 0x2A16, 0x0 }, false },
+	{ "epsilon", { 0x3B5, 0x0 }, false },
+	{ "emacr", { 0x113, 0x0 }, false },
+	{ "angle", { 0x2220, 0x0 }, false },
+	{ "ltcir", { 0x2A79, 0x0 }, false },
+	{ "Aacute", { 0xC1, 0x0 }, true },
+	{ "boxV", { 0x2551, 0x0 }, false },
+	{ "yen", { 0xA5, 0x0 }, true },
+	{ "lAarr", { 0x21DA, 0x0 }, false },
+	{ "Gammad", { 0x3DC, 0x0 }, false },
+	{ "UnderBracket", { 0x23B5, 0x0 }, false },
+	{ "infintie", { 0x29DD, 0x0 }, false },
+	{ "minusd", { 0x2238, 0x0 }, false },
+	{ "tilde", { 0x2DC, 0x0 }, false },
+	{ "scnap", { 0x2ABA, 0x0 }, false },
+	{ "DoubleDownArrow", { 0x21D3, 0x0 }, false },
+	{ "npreceq", { 0x2AAF, 0x338 }, false },
+	{ "GreaterEqual", { 0x2265, 0x0 }, false },
+	{ "Fscr", { 0x2131, 0x0 }, false },
+	{ "yacute", { 0xFD, 0x0 }, true },
+	{ "RightUpVectorBar", { 0x2954, 0x0 }, false },
+	{ "Hacek", { 0x2C7, 0x0 }, false },
+	{ "rdquo", { 0x201D, 0x0 }, false },
+	{ "isinE", { 0x22F9, 0x0 }, false },
+	{ "leftharpoonup", { 0x21BC, 0x0 }, false },
+	{ "Vdashl", { 0x2AE6, 0x0 }, false },
+	{ "circlearrowright", { 0x21BB, 0x0 }, false },
+	{ "SHCHcy", { 0x429, 0x0 }, false },
+	{ "Gopf", { 0x1D53E, 0x0 }, false },
+	{ "dtrif", { 0x25BE, 0x0 }, false },
+	{ "SmallCircle", { 0x2218, 0x0 }, false },
+	{ "fnof", { 0x192, 0x0 }, false },
+	{ "dcy", { 0x434, 0x0 }, false },
+	{ "leftharpoondown", { 0x21BD, 0x0 }, false },
+	{ "frac16", { 0x2159, 0x0 }, false },
+	{ "umacr", { 0x16B, 0x0 }, false },
+	{ "Pr", { 0x2ABB, 0x0 }, false },
+	{ "rarrap", { 0x2975, 0x0 }, false },
+	{ "DoubleLeftArrow", { 0x21D0, 0x0 }, false },
+	{ "llcorner", { 0x231E, 0x0 }, false },
+	{ "rightharpoondown", { 0x21C1, 0x0 }, false },
+	{ "pi", { 0x3C0, 0x0 }, false },
+	{ "lrm", { 0x200E, 0x0 }, false },
+	{ "lgE", { 0x2A91, 0x0 }, false },
+	{ "ubrcy", { 0x45E, 0x0 }, false },
+	{ "subne", { 0x228A, 0x0 }, false },
+	{ "acy", { 0x430, 0x0 }, false },
+	{ "dblac", { 0x2DD, 0x0 }, false },
+	{ "Int", { 0x222C, 0x0 }, false },
+	{ "utri", { 0x25B5, 0x0 }, false },
+	{ "Lsh", { 0x21B0, 0x0 }, false },
+	{ "sup1", { 0xB9, 0x0 }, true },
+	{ "ratio", { 0x2236, 0x0 }, false },
+	{ "gneqq", { 0x2269, 0x0 }, false },
+	{ "ReverseUpEquilibrium", { 0x296F, 0x0 }, false },
+	{ "Upsilon", { 0x3A5, 0x0 }, false },
+	{ "Succeeds", { 0x227B, 0x0 }, false },
+	{ "rsquor", { 0x2019, 0x0 }, false },
+	{ "gg", { 0x226B, 0x0 }, false },
+	{ "LongRightArrow", { 0x27F6, 0x0 }, false },
+	{ "circledast", { 0x229B, 0x0 }, false },
+	{ "TRADE", { 0x2122, 0x0 }, false },
+	{ "NoBreak", { 0x2060, 0x0 }, false },
+	{ "xharr", { 0x27F7, 0x0 }, false },
+	{ "OverBracket", { 0x23B4, 0x0 }, false },
+	{ "swarrow", { 0x2199, 0x0 }, false },
+	{ "npr", { 0x2280, 0x0 }, false },
+	{ "therefore", { 0x2234, 0x0 }, false },
+	{ "iquest", { 0xBF, 0x0 }, true },
+	{ "Lcedil", { 0x13B, 0x0 }, false },
+	{ "GreaterTilde", { 0x2273, 0x0 }, false },
+	{ "varsigma", { 0x3C2, 0x0 }, false },
+	{ "swArr", { 0x21D9, 0x0 }, false },
+	{ "Lt", { 0x226A, 0x0 }, false },
+	{ "bkarow", { 0x290D, 0x0 }, false },
+	{ "sdot", { 0x22C5, 0x0 }, false },
+	{ "dbkarow", { 0x290F, 0x0 }, false },
+	{ "semi", { 0x3B, 0x0 }, false },
+	{ "OpenCurlyQuote", { 0x2018, 0x0 }, false },
+	{ "DownLeftVector", { 0x21BD, 0x0 }, false },
+	{ "Bscr", { 0x212C, 0x0 }, false },
+	{ "lesg", { 0x22DA, 0xFE00 }, false },
+	{ "ucy", { 0x443, 0x0 }, false },
+	{ "TildeFullEqual", { 0x2245, 0x0 }, false },
+	{ "rsh", { 0x21B1, 0x0 }, false },
+	{ "NotLeftTriangleBar", { 0x29CF, 0x338 }, false },
+	{ "empty", { 0x2205, 0x0 }, false },
+	{ "duarr", { 0x21F5, 0x0 }, false },
+	{ "elsdot", { 0x2A97, 0x0 }, false },
+	{ "Aring", { 0xC5, 0x0 }, true },
+	{ "fpartint", { 0x2A0D, 0x0 }, false },
+	{ "nvdash", { 0x22AC, 0x0 }, false },
+	{ "Coproduct", { 0x2210, 0x0 }, false },
+	{ "phiv", { 0x3D5, 0x0 }, false },
+	{ "plankv", { 0x210F, 0x0 }, false },
+	{ "ltdot", { 0x22D6, 0x0 }, false },
+	{ "smid", { 0x2223, 0x0 }, false },
+	{ "tridot", { 0x25EC, 0x0 }, false },
+	{ "triangle", { 0x25B5, 0x0 }, false },
+	{ "bottom", { 0x22A5, 0x0 }, false },
+	{ "dharr", { 0x21C2, 0x0 }, false },
+	{ "ell", { 0x2113, 0x0 }, false },
+	{ "larrfs", { 0x291D, 0x0 }, false },
+	{ "there4", { 0x2234, 0x0 }, false },
+	{ "lang", { 0x27E8, 0x0 }, false },
+	{ "cscr", { 0x1D4B8, 0x0 }, false },
+	{ "qfr", { 0x1D52E, 0x0 }, false },
+	{ "raemptyv", { 0x29B3, 0x0 }, false },
+	{ "gamma", { 0x3B3, 0x0 }, false },
+	{ "csub", { 0x2ACF, 0x0 }, false },
+	{ "inodot", { 0x131, 0x0 }, false },
+	{ "esdot", { 0x2250, 0x0 }, false },
+	{ "wopf", { 0x1D568, 0x0 }, false },
+	{ "upsilon", { 0x3C5, 0x0 }, false },
+	{ "Ocirc", { 0xD4, 0x0 }, true },
+	{ "drcorn", { 0x231F, 0x0 }, false },
+	{ "commat", { 0x40, 0x0 }, false },
+	{ "nsupset", { 0x2283, 0x20D2 }, false },
+	{ "Icy", { 0x418, 0x0 }, false },
+	{ "Scedil", { 0x15E, 0x0 }, false },
+	{ "gscr", { 0x210A, 0x0 }, false },
+	{ "hookrightarrow", { 0x21AA, 0x0 }, false },
+	{ "cupcap", { 0x2A46, 0x0 }, false },
+	{ "supset", { 0x2283, 0x0 }, false },
+	{ "Tau", { 0x3A4, 0x0 }, false },
+	{ "backsimeq", { 0x22CD, 0x0 }, false },
+	{ "profalar", { 0x232E, 0x0 }, false },
+	{ "biguplus", { 0x2A04, 0x0 }, false },
+	{ "Dfr", { 0x1D507, 0x0 }, false },
+	{ "Colone", { 0x2A74, 0x0 }, false },
+	{ "ii", { 0x2148, 0x0 }, false },
+	{ "boxdr", { 0x250C, 0x0 }, false },
+	{ "neArr", { 0x21D7, 0x0 }, false },
+	{ "NegativeMediumSpace", { 0x200B, 0x0 }, false },
+	{ "boxVR", { 0x2560, 0x0 }, false },
+	{ "mid", { 0x2223, 0x0 }, false },
+	{ "Not", { 0x2AEC, 0x0 }, false },
+	{ "eogon", { 0x119, 0x0 }, false },
+	{ "drbkarow", { 0x2910, 0x0 }, false },
+	{ "LeftArrow", { 0x2190, 0x0 }, false },
+	{ "escr", { 0x212F, 0x0 }, false },
+	{ "LJcy", { 0x409, 0x0 }, false },
+	{ "vdash", { 0x22A2, 0x0 }, false },
+	{ "Kscr", { 0x1D4A6, 0x0 }, false },
+	{ "rnmid", { 0x2AEE, 0x0 }, false },
+	{ "scy", { 0x441, 0x0 }, false },
+	{ "boxul", { 0x2518, 0x0 }, false },
+	{ "DoubleUpArrow", { 0x21D1, 0x0 }, false },
+	{ "raquo", { 0xBB, 0x0 }, true },
+	{ "target", { 0x2316, 0x0 }, false },
+	{ "lsime", { 0x2A8D, 0x0 }, false },
+	{ "Hstrok", { 0x126, 0x0 }, false },
+	{ "boxvl", { 0x2524, 0x0 }, false },
+	{ "varsupsetneqq", { 0x2ACC, 0xFE00 }, false },
+	{ "RightAngleBracket", { 0x27E9, 0x0 }, false },
+	{ "lcy", { 0x43B, 0x0 }, false },
+	{ "eng", { 0x14B, 0x0 }, false },
+	{ "rarrfs", { 0x291E, 0x0 }, false },
+	{ "nsqsupe", { 0x22E3, 0x0 }, false },
+	{ "excl", { 0x21, 0x0 }, false },
+	{ "smtes", { 0x2AAC, 0xFE00 }, false },
+	{ "eqcolon", { 0x2255, 0x0 }, false },
+	{ "NotLessTilde", { 0x2274, 0x0 }, false },
+	{ "NotPrecedes", { 0x2280, 0x0 }, false },
+	{ "vltri", { 0x22B2, 0x0 }, false },
+	{ "origof", { 0x22B6, 0x0 }, false },
+	{ "srarr", { 0x2192, 0x0 }, false },
+	{ "zacute", { 0x17A, 0x0 }, false },
+	{ "Gt", { 0x226B, 0x0 }, false },
+	{ "Mscr", { 0x2133, 0x0 }, false },
+	{ "bigodot", { 0x2A00, 0x0 }, false },
+	{ "angmsdag", { 0x29AE, 0x0 }, false },
+	{ "shchcy", { 0x449, 0x0 }, false },
+	{ "boxUr", { 0x2559, 0x0 }, false },
+	{ "Mopf", { 0x1D544, 0x0 }, false },
+	{ "copy", { 0xA9, 0x0 }, true },
+	{ "duhar", { 0x296F, 0x0 }, false },
+	{ "zeta", { 0x3B6, 0x0 }, false },
+	{ "dcaron", { 0x10F, 0x0 }, false },
+	{ "NotSucceeds", { 0x2281, 0x0 }, false },
+	{ "uring", { 0x16F, 0x0 }, false },
+	{ "clubs", { 0x2663, 0x0 }, false },
+	{ "Pscr", { 0x1D4AB, 0x0 }, false },
+	{ "Xscr", { 0x1D4B3, 0x0 }, false },
+	{ "imacr", { 0x12B, 0x0 }, false },
+	{ "frac34", { 0xBE, 0x0 }, true },
+	{ "hoarr", { 0x21FF, 0x0 }, false },
+	{ "succsim", { 0x227F, 0x0 }, false },
+	{ "scnsim", { 0x22E9, 0x0 }, false },
+	{ "bigsqcup", { 0x2A06, 0x0 }, false },
+	{ "wedge", { 0x2227, 0x0 }, false },
+	{ "quest", { 0x3F, 0x0 }, false },
+	{ "Exists", { 0x2203, 0x0 }, false },
+	{ "CapitalDifferentialD", { 0x2145, 0x0 }, false },
+	{ "succnapprox", { 0x2ABA, 0x0 }, false },
+	{ "bigtriangledown", { 0x25BD, 0x0 }, false },
+	{ "topcir", { 0x2AF1, 0x0 }, false },
+	{ "odot", { 0x2299, 0x0 }, false },
+	{ "supsetneq", { 0x228B, 0x0 }, false },
+	{ "precapprox", { 0x2AB7, 0x0 }, false },
+	{ "loang", { 0x27EC, 0x0 }, false },
+	{ "lE", { 0x2266, 0x0 }, false },
+	{ "uharl", { 0x21BF, 0x0 }, false },
+	{ "nmid", { 0x2224, 0x0 }, false },
+	{ "Tcaron", { 0x164, 0x0 }, false },
+	{ "rtrie", { 0x22B5, 0x0 }, false },
+	{ "asymp", { 0x2248, 0x0 }, false },
+	{ "rrarr", { 0x21C9, 0x0 }, false },
+	{ "zcy", { 0x437, 0x0 }, false },
+	{ "boxdl", { 0x2510, 0x0 }, false },
+	{ "RightTriangle", { 0x22B3, 0x0 }, false },
+	{ "sqcups", { 0x2294, 0xFE00 }, false },
+	{ "boxDr", { 0x2553, 0x0 }, false },
+	{ "boxDl", { 0x2556, 0x0 }, false },
+	{ "brvbar", { 0xA6, 0x0 }, true },
+	{ "rangle", { 0x27E9, 0x0 }, false },
+	{ "bfr", { 0x1D51F, 0x0 }, false },
+	{ "deg", { 0xB0, 0x0 }, true },
+	{ "bsime", { 0x22CD, 0x0 }, false },
+	{ "supdot", { 0x2ABE, 0x0 }, false },
+	{ "bump", { 0x224E, 0x0 }, false },
+	{ "thickapprox", { 0x2248, 0x0 }, false },
+	{ "uogon", { 0x173, 0x0 }, false },
+	{ "ngeqslant", { 0x2A7E, 0x338 }, false },
+	{ "Hscr", { 0x210B, 0x0 }, false },
+	{ "xsqcup", { 0x2A06, 0x0 }, false },
+	{ "eqslantless", { 0x2A95, 0x0 }, false },
+	{ "sfrown", { 0x2322, 0x0 }, false },
+	{ "Vopf", { 0x1D54D, 0x0 }, false },
+	{ "GT", { 0x3E, 0x0 }, true },
+	{ "circlearrowleft", { 0x21BA, 0x0 }, false },
+	{ "otilde", { 0xF5, 0x0 }, true },
+	{ "boxH", { 0x2550, 0x0 }, false },
+	{ "horbar", { 0x2015, 0x0 }, false },
+	{ "supmult", { 0x2AC2, 0x0 }, false },
+	{ "triangleright", { 0x25B9, 0x0 }, false },
+	{ "vArr", { 0x21D5, 0x0 }, false },
+	{ "ll", { 0x226A, 0x0 }, false },
+	{ "vDash", { 0x22A8, 0x0 }, false },
+	{ "LeftDownTeeVector", { 0x2961, 0x0 }, false },
+	{ "ofcir", { 0x29BF, 0x0 }, false },
+	{ "triangleleft", { 0x25C3, 0x0 }, false },
+	{ "nedot", { 0x2250, 0x338 }, false },
+	{ "times", { 0xD7, 0x0 }, true },
+	{ "Vee", { 0x22C1, 0x0 }, false },
+	{ "apos", { 0x27, 0x0 }, false },
+	{ "copf", { 0x1D554, 0x0 }, false },
+	{ "rationals", { 0x211A, 0x0 }, false },
+	{ "diams", { 0x2666, 0x0 }, false },
+	{ "apacir", { 0x2A6F, 0x0 }, false },
+	{ "ycy", { 0x44B, 0x0 }, false },
+	{ "boxHd", { 0x2564, 0x0 }, false },
+	{ "bumpE", { 0x2AAE, 0x0 }, false },
+	{ "emsp14", { 0x2005, 0x0 }, false },
+	{ "OverParenthesis", { 0x23DC, 0x0 }, false },
+	{ "cuwed", { 0x22CF, 0x0 }, false },
+	{ "GreaterEqualLess", { 0x22DB, 0x0 }, false },
+	{ "cupcup", { 0x2A4A, 0x0 }, false },
+	{ "bopf", { 0x1D553, 0x0 }, false },
+	{ "LeftRightArrow", { 0x2194, 0x0 }, false },
+	{ "NotRightTriangleEqual", { 0x22ED, 0x0 }, false },
+	{ "straightepsilon", { 0x3F5, 0x0 }, false },
+	{ "barvee", { 0x22BD, 0x0 }, false },
+	{ "cup", { 0x222A, 0x0 }, false },
+	{ "NotHumpDownHump", { 0x224E, 0x338 }, false },
+	{ "lHar", { 0x2962, 0x0 }, false },
+	{ "Longrightarrow", { 0x27F9, 0x0 }, false },
+	{ "nshortparallel", { 0x2226, 0x0 }, false },
+	{ "LessTilde", { 0x2272, 0x0 }, false },
+	{ "napprox", { 0x2249, 0x0 }, false },
+	{ "NotVerticalBar", { 0x2224, 0x0 }, false },
+	{ "boxhu", { 0x2534, 0x0 }, false },
+	{ "LeftTeeVector", { 0x295A, 0x0 }, false },
+	{ "oplus", { 0x2295, 0x0 }, false },
+	{ "LeftTriangleEqual", { 0x22B4, 0x0 }, false },
+	{ "lurdshar", { 0x294A, 0x0 }, false },
+	{ "icirc", { 0xEE, 0x0 }, true },
+	{ "acE", { 0x223E, 0x333 }, false },
+	{ "nsucceq", { 0x2AB0, 0x338 }, false },
+	{ "map", { 0x21A6, 0x0 }, false },
+	{ "colon", { 0x3A, 0x0 }, false },
+	{ "harr", { 0x2194, 0x0 }, false },
+	{ "sigmaf", { 0x3C2, 0x0 }, false },
+	{ "Longleftrightarrow", { 0x27FA, 0x0 }, false },
+	{ "rcedil", { 0x157, 0x0 }, false },
+	{ "bnot", { 0x2310, 0x0 }, false },
+	{ "ddotseq", { 0x2A77, 0x0 }, false },
+	{ "leftrightarrow", { 0x2194, 0x0 }, false },
+	{ "tosa", { 0x2929, 0x0 }, false },
+	{ "Ccaron", { 0x10C, 0x0 }, false },
+	{ "nLeftarrow", { 0x21CD, 0x0 }, false },
+	{ "lowast", { 0x2217, 0x0 }, false },
+	{ "kcedil", { 0x137, 0x0 }, false },
+	{ "le", { 0x2264, 0x0 }, false },
+	{ "gtcc", { 0x2AA7, 0x0 }, false },
+	{ "uuarr", { 0x21C8, 0x0 }, false },
+	{ "frac15", { 0x2155, 0x0 }, false },
+	{ "plussim", { 0x2A26, 0x0 }, false },
+	{ "elinters", { 0x23E7, 0x0 }, false },
+	{ "gne", { 0x2A88, 0x0 }, false },
+	{ "rightrightarrows", { 0x21C9, 0x0 }, false },
+	{ "Sfr", { 0x1D516, 0x0 }, false },
+	{ "Iogon", { 0x12E, 0x0 }, false },
+	{ "nges", { 0x2A7E, 0x338 }, false },
+	{ "erDot", { 0x2253, 0x0 }, false },
+	{ "lrhard", { 0x296D, 0x0 }, false },
+	{ "darr", { 0x2193, 0x0 }, false },
+	{ "DiacriticalDoubleAcute", { 0x2DD, 0x0 }, false },
+	{ "Omega", { 0x3A9, 0x0 }, false },
+	{ "squf", { 0x25AA, 0x0 }, false },
+	{ "Fcy", { 0x424, 0x0 }, false },
+	{ "Tscr", { 0x1D4AF, 0x0 }, false },
+	{ "isins", { 0x22F4, 0x0 }, false },
+	{ "realine", { 0x211B, 0x0 }, false },
+	{ "NotLessEqual", { 0x2270, 0x0 }, false },
+	{ "rlarr", { 0x21C4, 0x0 }, false },
+	{ "RightArrow", { 0x2192, 0x0 }, false },
+	{ "Chi", { 0x3A7, 0x0 }, false },
+	{ "Kcedil", { 0x136, 0x0 }, false },
+	{ "xcirc", { 0x25EF, 0x0 }, false },
+	{ "SquareSupersetEqual", { 0x2292, 0x0 }, false },
+	{ "cwconint", { 0x2232, 0x0 }, false },
+	{ "egrave", { 0xE8, 0x0 }, true },
+	{ "ropar", { 0x2986, 0x0 }, false },
+	{ "aring", { 0xE5, 0x0 }, true },
+	{ "complexes", { 0x2102, 0x0 }, false },
+	{ "tritime", { 0x2A3B, 0x0 }, false },
+	{ "succapprox", { 0x2AB8, 0x0 }, false },
+	{ "simrarr", { 0x2972, 0x0 }, false },
+	{ "awconint", { 0x2233, 0x0 }, false },
+	{ "Gamma", { 0x393, 0x0 }, false },
+	{ "ccupssm", { 0x2A50, 0x0 }, false },
+	{ "varphi", { 0x3D5, 0x0 }, false },
+	{ "ee", { 0x2147, 0x0 }, false },
+	{ "gneq", { 0x2A88, 0x0 }, false },
+	{ "submult", { 0x2AC1, 0x0 }, false },
+	{ "nleq", { 0x2270, 0x0 }, false },
+	{ "ldrdhar", { 0x2967, 0x0 }, false },
+	{ "RightArrowBar", { 0x21E5, 0x0 }, false },
+	{ "NotSucceedsSlantEqual", { 0x22E1, 0x0 }, false },
+	{ "LessGreater", { 0x2276, 0x0 }, false },
+	{ "asympeq", { 0x224D, 0x0 }, false },
+	{ "RightDownVectorBar", { 0x2955, 0x0 }, false },
+	{ "nlArr", { 0x21CD, 0x0 }, false },
+	{ "lbrack", { 0x5B, 0x0 }, false },
+	{ "xhArr", { 0x27FA, 0x0 }, false },
+	{ "Uacute", { 0xDA, 0x0 }, true },
+	{ "Dashv", { 0x2AE4, 0x0 }, false },
+	{ "Racute", { 0x154, 0x0 }, false },
+	{ "NegativeThickSpace", { 0x200B, 0x0 }, false },
+	{ "order", { 0x2134, 0x0 }, false },
+	{ "nvle", { 0x2264, 0x20D2 }, false },
+	{ "EqualTilde", { 0x2242, 0x0 }, false },
+	{ "Prime", { 0x2033, 0x0 }, false },
+	{ "longleftrightarrow", { 0x27F7, 0x0 }, false },
+	{ "gE", { 0x2267, 0x0 }, false },
+	{ "ngsim", { 0x2275, 0x0 }, false },
+	{ "DDotrahd", { 0x2911, 0x0 }, false },
+	{ "homtht", { 0x223B, 0x0 }, false },
+	{ "barwed", { 0x2305, 0x0 }, false },
+	{ "longleftarrow", { 0x27F5, 0x0 }, false },
+	{ "jopf", { 0x1D55B, 0x0 }, false },
+	{ "lbrke", { 0x298B, 0x0 }, false },
+	{ "ange", { 0x29A4, 0x0 }, false },
+	{ "yacy", { 0x44F, 0x0 }, false },
+	{ "telrec", { 0x2315, 0x0 }, false },
+	{ "lopar", { 0x2985, 0x0 }, false },
+	{ "nesim", { 0x2242, 0x338 }, false },
+	{ "nleftarrow", { 0x219A, 0x0 }, false },
+	{ "zwnj", { 0x200C, 0x0 }, false },
+	{ "zigrarr", { 0x21DD, 0x0 }, false },
+	{ "itilde", { 0x129, 0x0 }, false },
+	{ "heartsuit", { 0x2665, 0x0 }, false },
+	{ "ouml", { 0xF6, 0x0 }, true },
+	{ "LeftUpVectorBar", { 0x2958, 0x0 }, false },
+	{ "thetasym", { 0x3D1, 0x0 }, false },
+	{ "ominus", { 0x2296, 0x0 }, false },
+	{ "Pi", { 0x3A0, 0x0 }, false },
+	{ "middot", { 0xB7, 0x0 }, true },
+	{ "egs", { 0x2A96, 0x0 }, false },
+	{ "cirscir", { 0x29C2, 0x0 }, false },
+	{ "uwangle", { 0x29A7, 0x0 }, false },
+	{ "ltrie", { 0x22B4, 0x0 }, false },
+	{ "eplus", { 0x2A71, 0x0 }, false },
+	{ "larrbfs", { 0x291F, 0x0 }, false },
+	{ "nvinfin", { 0x29DE, 0x0 }, false },
+	{ "uArr", { 0x21D1, 0x0 }, false },
+	{ "gt", { 0x3E, 0x0 }, true },
+	{ "smallsetminus", { 0x2216, 0x0 }, false },
+	{ "smashp", { 0x2A33, 0x0 }, false },
+	{ "Zacute", { 0x179, 0x0 }, false },
+	{ "iota", { 0x3B9, 0x0 }, false },
+	{ "DifferentialD", { 0x2146, 0x0 }, false },
+	{ "twoheadrightarrow", { 0x21A0, 0x0 }, false },
+	{ "dopf", { 0x1D555, 0x0 }, false },
+	{ "gesles", { 0x2A94, 0x0 }, false },
+	{ "longrightarrow", { 0x27F6, 0x0 }, false },
+	{ "blk34", { 0x2593, 0x0 }, false },
+	{ "LeftRightVector", { 0x294E, 0x0 }, false },
+	{ "Umacr", { 0x16A, 0x0 }, false },
+	{ "Uscr", { 0x1D4B0, 0x0 }, false },
+	{ "Beta", { 0x392, 0x0 }, false },
+	{ "DoubleContourIntegral", { 0x222F, 0x0 }, false },
+	{ "imath", { 0x131, 0x0 }, false },
+	{ "uacute", { 0xFA, 0x0 }, true },
+	{ "nge", { 0x2271, 0x0 }, false },
+	{ "ccaps", { 0x2A4D, 0x0 }, false },
+	{ "xcap", { 0x22C2, 0x0 }, false },
+	{ "nap", { 0x2249, 0x0 }, false },
+	{ "Abreve", { 0x102, 0x0 }, false },
+	{ "dtdot", { 0x22F1, 0x0 }, false },
+	{ "rang", { 0x27E9, 0x0 }, false },
+	{ "caron", { 0x2C7, 0x0 }, false },
+	{ "xutri", { 0x25B3, 0x0 }, false },
+	{ "thicksim", { 0x223C, 0x0 }, false },
+	{ "Conint", { 0x222F, 0x0 }, false },
+	{ "wreath", { 0x2240, 0x0 }, false },
+	{ "ape", { 0x224A, 0x0 }, false },
+	{ "boxUl", { 0x255C, 0x0 }, false },
+	{ "boxhD", { 0x2565, 0x0 }, false },
+	{ "bernou", { 0x212C, 0x0 }, false },
+	{ "Rcaron", { 0x158, 0x0 }, false },
+	{ "rArr", { 0x21D2, 0x0 }, false },
+	{ "Zopf", { 0x2124, 0x0 }, false },
+	{ "imped", { 0x1B5, 0x0 }, false },
+	{ "rarrlp", { 0x21AC, 0x0 }, false },
+	{ "Dscr", { 0x1D49F, 0x0 }, false },
+	{ "Iukcy", { 0x406, 0x0 }, false },
+	{ "ldquor", { 0x201E, 0x0 }, false },
+	{ "boxvL", { 0x2561, 0x0 }, false },
+	{ "Ofr", { 0x1D512, 0x0 }, false },
+	{ "Iopf", { 0x1D540, 0x0 }, false },
+	{ "tprime", { 0x2034, 0x0 }, false },
+	{ "ufisht", { 0x297E, 0x0 }, false },
+	{ "rHar", { 0x2964, 0x0 }, false },
+	{ "isinsv", { 0x22F3, 0x0 }, false },
+	{ "larrsim", { 0x2973, 0x0 }, false },
+	{ "cuesc", { 0x22DF, 0x0 }, false },
+	{ "Rfr", { 0x211C, 0x0 }, false },
+	{ "Zscr", { 0x1D4B5, 0x0 }, false },
+	{ "subrarr", { 0x2979, 0x0 }, false },
+	{ "lArr", { 0x21D0, 0x0 }, false },
+	{ "UpTee", { 0x22A5, 0x0 }, false },
+	{ "scaron", { 0x161, 0x0 }, false },
+	{ "ecy", { 0x44D, 0x0 }, false },
+	{ "nsub", { 0x2284, 0x0 }, false },
+	{ "bsol", { 0x5C, 0x0 }, false },
+	{ "vartriangleright", { 0x22B3, 0x0 }, false },
+	{ "racute", { 0x155, 0x0 }, false },
+	{ "iscr", { 0x1D4BE, 0x0 }, false },
+	{ "tdot", { 0x20DB, 0x0 }, false },
+	{ "euml", { 0xEB, 0x0 }, true },
+	{ "Uuml", { 0xDC, 0x0 }, true },
+	{ "langle", { 0x27E8, 0x0 }, false },
+	{ "reals", { 0x211D, 0x0 }, false },
+	{ "LongLeftRightArrow", { 0x27F7, 0x0 }, false },
+	{ "vopf", { 0x1D567, 0x0 }, false },
+	{ "lfloor", { 0x230A, 0x0 }, false },
+	{ "smt", { 0x2AAA, 0x0 }, false },
+	{ "rpargt", { 0x2994, 0x0 }, false },
+	{ "congdot", { 0x2A6D, 0x0 }, false },
+	{ "curlyvee", { 0x22CE, 0x0 }, false },
+	{ "profsurf", { 0x2313, 0x0 }, false },
+	{ "eth", { 0xF0, 0x0 }, true },
+	{ "ecaron", { 0x11B, 0x0 }, false },
+	{ "hookleftarrow", { 0x21A9, 0x0 }, false },
+	{ "not", { 0xAC, 0x0 }, true },
+	{ "lotimes", { 0x2A34, 0x0 }, false },
+	{ "vsubnE", { 0x2ACB, 0xFE00 }, false },
+	{ "xodot", { 0x2A00, 0x0 }, false },
+	{ "Ycy", { 0x42B, 0x0 }, false },
+	{ "straightphi", { 0x3D5, 0x0 }, false },
+	{ "Yuml", { 0x178, 0x0 }, false },
+	{ "dzigrarr", { 0x27FF, 0x0 }, false },
+	{ "CounterClockwiseContourIntegral", { 0x2233, 0x0 }, false },
+	{ "Integral", { 0x222B, 0x0 }, false },
+	{ "hfr", { 0x1D525, 0x0 }, false },
+	{ "Hopf", { 0x210D, 0x0 }, false },
+	{ "nrArr", { 0x21CF, 0x0 }, false },
+	{ "Superset", { 0x2283, 0x0 }, false },
+	{ "Alpha", { 0x391, 0x0 }, false },
+	{ "Iota", { 0x399, 0x0 }, false },
+	{ "Verbar", { 0x2016, 0x0 }, false },
+	{ "Nu", { 0x39D, 0x0 }, false },
+	{ "qint", { 0x2A0C, 0x0 }, false },
+	{ "qopf", { 0x1D562, 0x0 }, false },
+	{ "bsolb", { 0x29C5, 0x0 }, false },
+	{ "sqsube", { 0x2291, 0x0 }, false },
+	{ "frown", { 0x2322, 0x0 }, false },
+	{ "ne", { 0x2260, 0x0 }, false },
+	{ "nsucc", { 0x2281, 0x0 }, false },
+	{ "Kappa", { 0x39A, 0x0 }, false },
+	{ "nshortmid", { 0x2224, 0x0 }, false },
+	{ "Gdot", { 0x120, 0x0 }, false },
+	{ "boxh", { 0x2500, 0x0 }, false },
+	{ "boxUR", { 0x255A, 0x0 }, false },
+	{ "mcy", { 0x43C, 0x0 }, false },
+	{ "frac45", { 0x2158, 0x0 }, false },
+	{ "rsqb", { 0x5D, 0x0 }, false },
+	{ "chcy", { 0x447, 0x0 }, false },
+	{ "ic", { 0x2063, 0x0 }, false },
+	{ "rangd", { 0x2992, 0x0 }, false },
+	{ "mldr", { 0x2026, 0x0 }, false },
+	{ "IOcy", { 0x401, 0x0 }, false },
+	{ "rppolint", { 0x2A12, 0x0 }, false },
+	{ "iocy", { 0x451, 0x0 }, false },
+	{ "xopf", { 0x1D569, 0x0 }, false },
+	{ "supplus", { 0x2AC0, 0x0 }, false },
+	{ "Jfr", { 0x1D50D, 0x0 }, false },
+	{ "simdot", { 0x2A6A, 0x0 }, false },
+	{ "lagran", { 0x2112, 0x0 }, false },
+	{ "triangledown", { 0x25BF, 0x0 }, false },
+	{ "veebar", { 0x22BB, 0x0 }, false },
+	{ "subdot", { 0x2ABD, 0x0 }, false },
+	{ "DoubleLongLeftRightArrow", { 0x27FA, 0x0 }, false },
+	{ "subsup", { 0x2AD3, 0x0 }, false },
+	{ "simg", { 0x2A9E, 0x0 }, false },
+	{ "bNot", { 0x2AED, 0x0 }, false },
+	{ "Precedes", { 0x227A, 0x0 }, false },
+	{ "udblac", { 0x171, 0x0 }, false },
+	{ "varsubsetneq", { 0x228A, 0xFE00 }, false },
+	{ "Nfr", { 0x1D511, 0x0 }, false },
+	{ "boxVl", { 0x2562, 0x0 }, false },
+	{ "lceil", { 0x2308, 0x0 }, false },
+	{ "Topf", { 0x1D54B, 0x0 }, false },
+	{ "frac58", { 0x215D, 0x0 }, false },
+	{ "ShortRightArrow", { 0x2192, 0x0 }, false },
+	{ "hearts", { 0x2665, 0x0 }, false },
+	{ "dotsquare", { 0x22A1, 0x0 }, false },
+	{ "Epsilon", { 0x395, 0x0 }, false },
+	{ "nvltrie", { 0x22B4, 0x20D2 }, false },
+	{ "larrpl", { 0x2939, 0x0 }, false },
+	{ "Gfr", { 0x1D50A, 0x0 }, false },
+	{ "DoubleLeftTee", { 0x2AE4, 0x0 }, false },
+	{ "rightharpoonup", { 0x21C0, 0x0 }, false },
+	{ "Star", { 0x22C6, 0x0 }, false },
+	{ "varsupsetneq", { 0x228B, 0xFE00 }, false },
+	{ "lhard", { 0x21BD, 0x0 }, false },
+	{ "divonx", { 0x22C7, 0x0 }, false },
+	{ "gsiml", { 0x2A90, 0x0 }, false },
+	{ "sharp", { 0x266F, 0x0 }, false },
+	{ "ni", { 0x220B, 0x0 }, false },
+	{ "frac78", { 0x215E, 0x0 }, false },
+	{ "Or", { 0x2A54, 0x0 }, false },
+	{ "curlywedge", { 0x22CF, 0x0 }, false },
+	{ "frac13", { 0x2153, 0x0 }, false },
+	{ "plusacir", { 0x2A23, 0x0 }, false },
+	{ "lnap", { 0x2A89, 0x0 }, false },
+	{ "rhov", { 0x3F1, 0x0 }, false },
+	{ "bullet", { 0x2022, 0x0 }, false },
+	{ "sdote", { 0x2A66, 0x0 }, false },
+	{ "ShortDownArrow", { 0x2193, 0x0 }, false },
+	{ "lltri", { 0x25FA, 0x0 }, false },
+	{ "xmap", { 0x27FC, 0x0 }, false },
+	{ "eDot", { 0x2251, 0x0 }, false },
+	{ "lmoustache", { 0x23B0, 0x0 }, false },
+	{ "rdsh", { 0x21B3, 0x0 }, false },
+	{ "imagpart", { 0x2111, 0x0 }, false },
+	{ "Cross", { 0x2A2F, 0x0 }, false },
+	{ "CloseCurlyDoubleQuote", { 0x201D, 0x0 }, false },
+	{ "les", { 0x2A7D, 0x0 }, false },
+	{ "nleqq", { 0x2266, 0x338 }, false },
+	{ "gjcy", { 0x453, 0x0 }, false },
+	{ "bigotimes", { 0x2A02, 0x0 }, false },
+	{ "uscr", { 0x1D4CA, 0x0 }, false },
+	{ "NotSquareSubsetEqual", { 0x22E2, 0x0 }, false },
+	{ "Jscr", { 0x1D4A5, 0x0 }, false },
+	{ "Yfr", { 0x1D51C, 0x0 }, false },
+	{ "Lmidot", { 0x13F, 0x0 }, false },
+	{ "subsetneqq", { 0x2ACB, 0x0 }, false },
+	{ "trianglelefteq", { 0x22B4, 0x0 }, false },
+	{ "tcedil", { 0x163, 0x0 }, false },
+	{ "ldca", { 0x2936, 0x0 }, false },
+	{ "rho", { 0x3C1, 0x0 }, false },
+	{ "lneq", { 0x2A87, 0x0 }, false },
+	{ "coloneq", { 0x2254, 0x0 }, false },
+	{ "LeftTeeArrow", { 0x21A4, 0x0 }, false },
+	{ "boxur", { 0x2514, 0x0 }, false },
+	{ "mu", { 0x3BC, 0x0 }, false },
+	{ "RightTeeArrow", { 0x21A6, 0x0 }, false },
+	{ "nrightarrow", { 0x219B, 0x0 }, false },
+	{ "quaternions", { 0x210D, 0x0 }, false },
+	{ "caps", { 0x2229, 0xFE00 }, false },
+	{ "gtlPar", { 0x2995, 0x0 }, false },
+	{ "nesear", { 0x2928, 0x0 }, false },
+	{ "utilde", { 0x169, 0x0 }, false },
+	{ "lopf", { 0x1D55D, 0x0 }, false },
+	{ "crarr", { 0x21B5, 0x0 }, false },
+	{ "angmsdac", { 0x29AA, 0x0 }, false },
+	{ "sqcup", { 0x2294, 0x0 }, false },
+	{ "softcy", { 0x44C, 0x0 }, false },
+	{ "supnE", { 0x2ACC, 0x0 }, false },
+	{ "iecy", { 0x435, 0x0 }, false },
+	{ "ltquest", { 0x2A7B, 0x0 }, false },
+	{ "OElig", { 0x152, 0x0 }, false },
+	{ "PrecedesEqual", { 0x2AAF, 0x0 }, false },
+	{ "dharl", { 0x21C3, 0x0 }, false },
+	{ "UpArrowBar", { 0x2912, 0x0 }, false },
+	{ "RightTriangleEqual", { 0x22B5, 0x0 }, false },
+	{ "dollar", { 0x24, 0x0 }, false },
+	{ "cdot", { 0x10B, 0x0 }, false },
+	{ "lesges", { 0x2A93, 0x0 }, false },
+	{ "rmoustache", { 0x23B1, 0x0 }, false },
+	{ "szlig", { 0xDF, 0x0 }, true },
+	{ "hopf", { 0x1D559, 0x0 }, false },
+	{ "ordf", { 0xAA, 0x0 }, true },
+	{ "prec", { 0x227A, 0x0 }, false },
+	{ "siml", { 0x2A9D, 0x0 }, false },
+	{ "PrecedesTilde", { 0x227E, 0x0 }, false },
+	{ "epar", { 0x22D5, 0x0 }, false },
+	{ "Leftarrow", { 0x21D0, 0x0 }, false },
+	{ "Eogon", { 0x118, 0x0 }, false },
+	{ "NestedGreaterGreater", { 0x226B, 0x0 }, false },
+	{ "napos", { 0x149, 0x0 }, false },
+	{ "NotGreaterFullEqual", { 0x2267, 0x338 }, false },
+	{ "qprime", { 0x2057, 0x0 }, false },
+	{ "exist", { 0x2203, 0x0 }, false },
+	{ "Eta", { 0x397, 0x0 }, false },
+	{ "backsim", { 0x223D, 0x0 }, false },
+	{ "larrb", { 0x21E4, 0x0 }, false },
+	{ "Ycirc", { 0x176, 0x0 }, false },
+	{ "Rcedil", { 0x156, 0x0 }, false },
+	{ "varnothing", { 0x2205, 0x0 }, false },
+	{ "iprod", { 0x2A3C, 0x0 }, false },
+	{ "npar", { 0x2226, 0x0 }, false },
+	{ "supdsub", { 0x2AD8, 0x0 }, false },
+	{ "Edot", { 0x116, 0x0 }, false },
+	{ "searrow", { 0x2198, 0x0 }, false },
+	{ "rAarr", { 0x21DB, 0x0 }, false },
+	{ "Idot", { 0x130, 0x0 }, false },
+	{ "uHar", { 0x2963, 0x0 }, false },
+	{ "RightDownVector", { 0x21C2, 0x0 }, false },
+	{ "dd", { 0x2146, 0x0 }, false },
+	{ "InvisibleTimes", { 0x2062, 0x0 }, false },
+	{ "eqsim", { 0x2242, 0x0 }, false },
+	{ "circeq", { 0x2257, 0x0 }, false },
+	{ "lsimg", { 0x2A8F, 0x0 }, false },
+	{ "rarrtl", { 0x21A3, 0x0 }, false },
+	{ "hamilt", { 0x210B, 0x0 }, false },
+	{ "sum", { 0x2211, 0x0 }, false },
+	{ "LeftUpDownVector", { 0x2951, 0x0 }, false },
+	{ "sqcap", { 0x2293, 0x0 }, false },
+	{ "lcaron", { 0x13E, 0x0 }, false },
+	{ "Atilde", { 0xC3, 0x0 }, true },
+	{ "iiota", { 0x2129, 0x0 }, false },
+	{ "cir", { 0x25CB, 0x0 }, false },
+	{ "verbar", { 0x7C, 0x0 }, false },
+	{ "part", { 0x2202, 0x0 }, false },
+	{ "ssetmn", { 0x2216, 0x0 }, false },
+	{ "Iscr", { 0x2110, 0x0 }, false },
+	{ "Square", { 0x25A1, 0x0 }, false },
+	{ "theta", { 0x3B8, 0x0 }, false },
+	{ "iukcy", { 0x456, 0x0 }, false },
+	{ "loplus", { 0x2A2D, 0x0 }, false },
+	{ "pointint", { 0x2A15, 0x0 }, false },
+	{ "late", { 0x2AAD, 0x0 }, false },
+	{ "rbrke", { 0x298C, 0x0 }, false },
+	{ "SquareSuperset", { 0x2290, 0x0 }, false },
+	{ "ENG", { 0x14A, 0x0 }, false },
+	{ "lesseqgtr", { 0x22DA, 0x0 }, false },
+	{ "lt", { 0x3C, 0x0 }, true },
+	{ "Equal", { 0x2A75, 0x0 }, false },
+	{ "geqslant", { 0x2A7E, 0x0 }, false },
+	{ "nparsl", { 0x2AFD, 0x20E5 }, false },
+	{ "pfr", { 0x1D52D, 0x0 }, false },
+	{ "between", { 0x226C, 0x0 }, false },
+	{ "NotCupCap", { 0x226D, 0x0 }, false },
+	{ "roang", { 0x27ED, 0x0 }, false },
+	{ "psi", { 0x3C8, 0x0 }, false },
+	{ "zscr", { 0x1D4CF, 0x0 }, false },
+	{ "curvearrowright", { 0x21B7, 0x0 }, false },
+	{ "lessdot", { 0x22D6, 0x0 }, false },
+	{ "RightCeiling", { 0x2309, 0x0 }, false },
+	{ "sqsup", { 0x2290, 0x0 }, false },
+	{ "UpTeeArrow", { 0x21A5, 0x0 }, false },
+	{ "wcirc", { 0x175, 0x0 }, false },
+	{ "hardcy", { 0x44A, 0x0 }, false },
+	{ "period", { 0x2E, 0x0 }, false },
+	{ "leftarrow", { 0x2190, 0x0 }, false },
+	{ "notni", { 0x220C, 0x0 }, false },
+	{ "DD", { 0x2145, 0x0 }, false },
+	{ "equivDD", { 0x2A78, 0x0 }, false },
+	{ "andd", { 0x2A5C, 0x0 }, false },
+	{ "digamma", { 0x3DD, 0x0 }, false },
+	{ "ContourIntegral", { 0x222E, 0x0 }, false },
+	{ "looparrowleft", { 0x21AB, 0x0 }, false },
+	{ "rarrpl", { 0x2945, 0x0 }, false },
+	{ "Union", { 0x22C3, 0x0 }, false },
+	{ "Scaron", { 0x160, 0x0 }, false },
+	{ "npolint", { 0x2A14, 0x0 }, false },
+	{ "Escr", { 0x2130, 0x0 }, false },
+	{ "luruhar", { 0x2966, 0x0 }, false },
+	{ "iuml", { 0xEF, 0x0 }, true },
+	{ "lsaquo", { 0x2039, 0x0 }, false },
+	{ "micro", { 0xB5, 0x0 }, true },
+	{ "UnderParenthesis", { 0x23DD, 0x0 }, false },
+	{ "plustwo", { 0x2A27, 0x0 }, false },
+	{ "nLtv", { 0x226A, 0x338 }, false },
+	{ "CirclePlus", { 0x2295, 0x0 }, false },
+	{ "minusdu", { 0x2A2A, 0x0 }, false },
+	{ "oast", { 0x229B, 0x0 }, false },
+	{ "frac25", { 0x2156, 0x0 }, false },
+	{ "SucceedsTilde", { 0x227F, 0x0 }, false },
+	{ "bcong", { 0x224C, 0x0 }, false },
+	{ "trisb", { 0x29CD, 0x0 }, false },
+	{ "sstarf", { 0x22C6, 0x0 }, false },
+	{ "lesdoto", { 0x2A81, 0x0 }, false },
+	{ "ntgl", { 0x2279, 0x0 }, false },
+	{ "scsim", { 0x227F, 0x0 }, false },
+	{ "flat", { 0x266D, 0x0 }, false },
+	{ "ncy", { 0x43D, 0x0 }, false },
+	{ "rect", { 0x25AD, 0x0 }, false },
+	{ "notnivb", { 0x22FE, 0x0 }, false },
+	{ "Leftrightarrow", { 0x21D4, 0x0 }, false },
+	{ "xnis", { 0x22FB, 0x0 }, false },
+	{ "notinva", { 0x2209, 0x0 }, false },
+	{ "iexcl", { 0xA1, 0x0 }, true },
+	{ "sqsubset", { 0x228F, 0x0 }, false },
+	{ "ShortUpArrow", { 0x2191, 0x0 }, false },
+	{ "AMP", { 0x26, 0x0 }, true },
+	{ "blacklozenge", { 0x29EB, 0x0 }, false },
+	{ "ncup", { 0x2A42, 0x0 }, false },
+	{ "Iuml", { 0xCF, 0x0 }, true },
+	{ "filig", { 0xFB01, 0x0 }, false },
+	{ "nsccue", { 0x22E1, 0x0 }, false },
+	{ "rdquor", { 0x201D, 0x0 }, false },
+	{ "boxDR", { 0x2554, 0x0 }, false },
+	{ "Copf", { 0x2102, 0x0 }, false },
+	{ "yucy", { 0x44E, 0x0 }, false },
+	{ "uarr", { 0x2191, 0x0 }, false },
+	{ "Rarr", { 0x21A0, 0x0 }, false },
+	{ "ClockwiseContourIntegral", { 0x2232, 0x0 }, false },
+	{ "NotTildeEqual", { 0x2244, 0x0 }, false },
+	{ "nhpar", { 0x2AF2, 0x0 }, false },
+	{ "supsub", { 0x2AD4, 0x0 }, false },
+	{ "uuml", { 0xFC, 0x0 }, true },
+	{ "Ouml", { 0xD6, 0x0 }, true },
+	{ "wedgeq", { 0x2259, 0x0 }, false },
+	{ "sung", { 0x266A, 0x0 }, false },
+	{ "prsim", { 0x227E, 0x0 }, false },
+	{ "marker", { 0x25AE, 0x0 }, false },
+	{ "Lambda", { 0x39B, 0x0 }, false },
+	{ "Sigma", { 0x3A3, 0x0 }, false },
+	{ "xfr", { 0x1D535, 0x0 }, false },
+	{ "NotNestedLessLess", { 0x2AA1, 0x338 }, false },
+	{ "djcy", { 0x452, 0x0 }, false },
+	{ "ccups", { 0x2A4C, 0x0 }, false },
+	{ "jscr", { 0x1D4BF, 0x0 }, false },
+	{ "nbump", { 0x224E, 0x338 }, false },
+	{ "plusdo", { 0x2214, 0x0 }, false },
+	{ "Wfr", { 0x1D51A, 0x0 }, false },
+	{ "ndash", { 0x2013, 0x0 }, false },
+	{ "cirE", { 0x29C3, 0x0 }, false },
+	{ "lozf", { 0x29EB, 0x0 }, false },
+	{ "nsimeq", { 0x2244, 0x0 }, false },
+	{ "IJlig", { 0x132, 0x0 }, false },
+	{ "Utilde", { 0x168, 0x0 }, false },
+	{ "rthree", { 0x22CC, 0x0 }, false },
+	{ "models", { 0x22A7, 0x0 }, false },
+	{ "ngtr", { 0x226F, 0x0 }, false },
+	{ "jcirc", { 0x135, 0x0 }, false },
+	{ "llarr", { 0x21C7, 0x0 }, false },
+	{ "efr", { 0x1D522, 0x0 }, false },
+	{ "vnsub", { 0x2282, 0x20D2 }, false },
+	{ "lsim", { 0x2272, 0x0 }, false },
+	{ "nlsim", { 0x2274, 0x0 }, false },
+	{ "esim", { 0x2242, 0x0 }, false },
+	{ "Zdot", { 0x17B, 0x0 }, false },
+	{ "boxuR", { 0x2558, 0x0 }, false },
+	{ "TScy", { 0x426, 0x0 }, false },
+	{ "lambda", { 0x3BB, 0x0 }, false },
+	{ "puncsp", { 0x2008, 0x0 }, false },
+	{ "GreaterLess", { 0x2277, 0x0 }, false },
+	{ "VerticalTilde", { 0x2240, 0x0 }, false },
+	{ "emsp", { 0x2003, 0x0 }, false },
+	{ "zeetrf", { 0x2128, 0x0 }, false },
+	{ "rightleftharpoons", { 0x21CC, 0x0 }, false },
+	{ "rtrif", { 0x25B8, 0x0 }, false },
+	{ "bbrk", { 0x23B5, 0x0 }, false },
+	{ "intprod", { 0x2A3C, 0x0 }, false },
+	{ "HARDcy", { 0x42A, 0x0 }, false },
+	{ "otimes", { 0x2297, 0x0 }, false },
+	{ "lharul", { 0x296A, 0x0 }, false },
+	{ "ecir", { 0x2256, 0x0 }, false },
+	{ "iff", { 0x21D4, 0x0 }, false },
+	{ "uparrow", { 0x2191, 0x0 }, false },
+	{ "LessEqualGreater", { 0x22DA, 0x0 }, false },
+	{ "sqsupe", { 0x2292, 0x0 }, false },
+	{ "vfr", { 0x1D533, 0x0 }, false },
+	{ "Cap", { 0x22D2, 0x0 }, false },
+	{ "boxhd", { 0x252C, 0x0 }, false },
+	{ "NotPrecedesEqual", { 0x2AAF, 0x338 }, false },
+	{ "DoubleRightTee", { 0x22A8, 0x0 }, false },
+	{ "HorizontalLine", { 0x2500, 0x0 }, false },
+	{ "female", { 0x2640, 0x0 }, false },
+	{ "njcy", { 0x45A, 0x0 }, false },
+	{ "Qopf", { 0x211A, 0x0 }, false },
+	{ "GreaterGreater", { 0x2AA2, 0x0 }, false },
+	{ "UpperRightArrow", { 0x2197, 0x0 }, false },
+	{ "bscr", { 0x1D4B7, 0x0 }, false },
+	{ "notnivc", { 0x22FD, 0x0 }, false },
+	{ "Jsercy", { 0x408, 0x0 }, false },
+	{ "vsupne", { 0x228B, 0xFE00 }, false },
+	{ "Acirc", { 0xC2, 0x0 }, true },
+	{ "planck", { 0x210F, 0x0 }, false },
+	{ "NotSuperset", { 0x2283, 0x20D2 }, false },
+	{ "boxvR", { 0x255E, 0x0 }, false },
+	{ "yuml", { 0xFF, 0x0 }, true },
+	{ "bigtriangleup", { 0x25B3, 0x0 }, false },
+	{ "Auml", { 0xC4, 0x0 }, true },
+	{ "sup", { 0x2283, 0x0 }, false },
+	{ "rbrkslu", { 0x2990, 0x0 }, false },
+	{ "gcirc", { 0x11D, 0x0 }, false },
+	{ "angmsdaf", { 0x29AD, 0x0 }, false },
+	{ "llhard", { 0x296B, 0x0 }, false },
+	{ "npre", { 0x2AAF, 0x338 }, false },
+	{ "para", { 0xB6, 0x0 }, true },
+	{ "breve", { 0x2D8, 0x0 }, false },
+	{ "DownLeftVectorBar", { 0x2956, 0x0 }, false },
+	{ "Nscr", { 0x1D4A9, 0x0 }, false },
+	{ "nsupe", { 0x2289, 0x0 }, false },
+	{ "DownLeftTeeVector", { 0x295E, 0x0 }, false },
+	{ "ultri", { 0x25F8, 0x0 }, false },
+	{ "Iacute", { 0xCD, 0x0 }, true },
+	{ "oacute", { 0xF3, 0x0 }, true },
+	{ "NotLessGreater", { 0x2278, 0x0 }, false },
+	{ "ETH", { 0xD0, 0x0 }, true },
+	{ "gtcir", { 0x2A7A, 0x0 }, false },
+	{ "pscr", { 0x1D4C5, 0x0 }, false },
+	{ "LessFullEqual", { 0x2266, 0x0 }, false },
+	{ "amp", { 0x26, 0x0 }, true },
+	{ "oslash", { 0xF8, 0x0 }, true },
+	{ "gammad", { 0x3DD, 0x0 }, false },
+	{ "ltrPar", { 0x2996, 0x0 }, false },
+	{ "dstrok", { 0x111, 0x0 }, false },
+	{ "varkappa", { 0x3F0, 0x0 }, false },
+	{ "scirc", { 0x15D, 0x0 }, false },
+	{ "nwarr", { 0x2196, 0x0 }, false },
+	{ "cent", { 0xA2, 0x0 }, true },
+	{ "ecolon", { 0x2255, 0x0 }, false },
+	{ "rmoust", { 0x23B1, 0x0 }, false },
+	{ "succeq", { 0x2AB0, 0x0 }, false },
+	{ "vrtri", { 0x22B3, 0x0 }, false },
+	{ "Sacute", { 0x15A, 0x0 }, false },
+	{ "pr", { 0x227A, 0x0 }, false },
+	{ "rightarrow", { 0x2192, 0x0 }, false },
+	{ "dashv", { 0x22A3, 0x0 }, false },
+	{ "LongLeftArrow", { 0x27F5, 0x0 }, false },
+	{ "natural", { 0x266E, 0x0 }, false },
+	{ "edot", { 0x117, 0x0 }, false },
+	{ "oscr", { 0x2134, 0x0 }, false },
+	{ "vsupnE", { 0x2ACC, 0xFE00 }, false },
+	{ "gopf", { 0x1D558, 0x0 }, false },
+	{ "supsetneqq", { 0x2ACC, 0x0 }, false },
+	{ "Agrave", { 0xC0, 0x0 }, true },
+	{ "sqsupseteq", { 0x2292, 0x0 }, false },
+	{ "dfr", { 0x1D521, 0x0 }, false },
+	{ "LessLess", { 0x2AA1, 0x0 }, false },
+	{ "angrtvb", { 0x22BE, 0x0 }, false },
+	{ "tcaron", { 0x165, 0x0 }, false },
+	{ "CupCap", { 0x224D, 0x0 }, false },
+	{ "simlE", { 0x2A9F, 0x0 }, false },
+	{ "Cfr", { 0x212D, 0x0 }, false },
+	{ "nVDash", { 0x22AF, 0x0 }, false },
+	{ "nearr", { 0x2197, 0x0 }, false },
+	{ "rarr", { 0x2192, 0x0 }, false },
+	{ "ast", { 0x2A, 0x0 }, false },
+	{ "lbrace", { 0x7B, 0x0 }, false },
+	{ "succcurlyeq", { 0x227D, 0x0 }, false },
+	{ "bowtie", { 0x22C8, 0x0 }, false },
+	{ "ThinSpace", { 0x2009, 0x0 }, false },
+	{ "Aopf", { 0x1D538, 0x0 }, false },
+	{ "Mu", { 0x39C, 0x0 }, false },
+	{ "sime", { 0x2243, 0x0 }, false },
+	{ "numsp", { 0x2007, 0x0 }, false },
+	{ "NotElement", { 0x2209, 0x0 }, false },
+	{ "trianglerighteq", { 0x22B5, 0x0 }, false },
+	{ "leftrightarrows", { 0x21C6, 0x0 }, false },
+	{ "LeftVector", { 0x21BC, 0x0 }, false },
+	{ "piv", { 0x3D6, 0x0 }, false },
+	{ "mlcp", { 0x2ADB, 0x0 }, false },
+	{ "OverBrace", { 0x23DE, 0x0 }, false },
+	{ "trpezium", { 0x23E2, 0x0 }, false },
+	{ "Igrave", { 0xCC, 0x0 }, true },
+	{ "Sup", { 0x22D1, 0x0 }, false },
+	{ "mscr", { 0x1D4C2, 0x0 }, false },
+	{ "uhblk", { 0x2580, 0x0 }, false },
+	{ "rightleftarrows", { 0x21C4, 0x0 }, false },
+	{ "nsupseteqq", { 0x2AC6, 0x338 }, false },
+	{ "amacr", { 0x101, 0x0 }, false },
+	{ "angmsdah", { 0x29AF, 0x0 }, false },
+	{ "permil", { 0x2030, 0x0 }, false },
+	{ "nsc", { 0x2281, 0x0 }, false },
+	{ "vangrt", { 0x299C, 0x0 }, false },
+	{ "lneqq", { 0x2268, 0x0 }, false },
+	{ "Eacute", { 0xC9, 0x0 }, true },
+	{ "gnapprox", { 0x2A8A, 0x0 }, false },
+	{ "hairsp", { 0x200A, 0x0 }, false },
+	{ "cuepr", { 0x22DE, 0x0 }, false },
+	{ "NotCongruent", { 0x2262, 0x0 }, false },
+	{ "fopf", { 0x1D557, 0x0 }, false },
+	{ "odiv", { 0x2A38, 0x0 }, false },
+	{ "blk14", { 0x2591, 0x0 }, false },
+	{ "iopf", { 0x1D55A, 0x0 }, false },
+	{ "nleqslant", { 0x2A7D, 0x338 }, false },
+	{ "orderof", { 0x2134, 0x0 }, false },
+	{ "ulcrop", { 0x230F, 0x0 }, false },
+	{ "mapsto", { 0x21A6, 0x0 }, false },
+	{ "DScy", { 0x405, 0x0 }, false },
+	{ "Sscr", { 0x1D4AE, 0x0 }, false },
+	{ "dot", { 0x2D9, 0x0 }, false },
+	{ "Lacute", { 0x139, 0x0 }, false },
+	{ "lowbar", { 0x5F, 0x0 }, false },
+	{ "ngeq", { 0x2271, 0x0 }, false },
+	{ "aopf", { 0x1D552, 0x0 }, false },
+	{ "subplus", { 0x2ABF, 0x0 }, false },
+	{ "amalg", { 0x2A3F, 0x0 }, false },
+	{ "thetav", { 0x3D1, 0x0 }, false },
+	{ "squarf", { 0x25AA, 0x0 }, false },
+	{ "Vvdash", { 0x22AA, 0x0 }, false },
+	{ "diamondsuit", { 0x2666, 0x0 }, false },
+	{ "DoubleLongRightArrow", { 0x27F9, 0x0 }, false },
+	{ "vprop", { 0x221D, 0x0 }, false },
+	{ "SubsetEqual", { 0x2286, 0x0 }, false },
+	{ "ocy", { 0x43E, 0x0 }, false },
+	{ "eqslantgtr", { 0x2A96, 0x0 }, false },
+	{ "Ocy", { 0x41E, 0x0 }, false },
+	{ "iiiint", { 0x2A0C, 0x0 }, false },
+	{ "fscr", { 0x1D4BB, 0x0 }, false },
+	{ "larrlp", { 0x21AB, 0x0 }, false },
+	{ "gtdot", { 0x22D7, 0x0 }, false },
+	{ "gel", { 0x22DB, 0x0 }, false },
+	{ "daleth", { 0x2138, 0x0 }, false },
+	{ "kscr", { 0x1D4C0, 0x0 }, false },
+	{ "rtimes", { 0x22CA, 0x0 }, false },
+	{ "urcorner", { 0x231D, 0x0 }, false },
+	{ "lsquor", { 0x201A, 0x0 }, false },
+	{ "Vbar", { 0x2AEB, 0x0 }, false },
+	{ "Ntilde", { 0xD1, 0x0 }, true },
+	{ "Dcy", { 0x414, 0x0 }, false },
+	{ "mapstoleft", { 0x21A4, 0x0 }, false },
+	{ "rbrace", { 0x7D, 0x0 }, false },
+	{ "Ecy", { 0x42D, 0x0 }, false },
+	{ "triplus", { 0x2A39, 0x0 }, false },
+	{ "aelig", { 0xE6, 0x0 }, true },
+	{ "gbreve", { 0x11F, 0x0 }, false },
+	{ "integers", { 0x2124, 0x0 }, false },
+	{ "comp", { 0x2201, 0x0 }, false },
+	{ "lvertneqq", { 0x2268, 0xFE00 }, false },
+	{ "boxUL", { 0x255D, 0x0 }, false },
+	{ "FilledVerySmallSquare", { 0x25AA, 0x0 }, false },
+	{ "emptyset", { 0x2205, 0x0 }, false },
+	{ "loz", { 0x25CA, 0x0 }, false },
+	{ "shy", { 0xAD, 0x0 }, true },
+	{ "prnap", { 0x2AB9, 0x0 }, false },
+	{ "KJcy", { 0x40C, 0x0 }, false },
+	{ "rharul", { 0x296C, 0x0 }, false },
+	{ "lobrk", { 0x27E6, 0x0 }, false },
+	{ "pound", { 0xA3, 0x0 }, true },
+	{ "circ", { 0x2C6, 0x0 }, false },
+	{ "gnE", { 0x2269, 0x0 }, false },
+	{ "nvgt", { 0x3E, 0x20D2 }, false },
+	{ "iogon", { 0x12F, 0x0 }, false },
+	{ "angsph", { 0x2222, 0x0 }, false },
+	{ "chi", { 0x3C7, 0x0 }, false },
+	{ "hstrok", { 0x127, 0x0 }, false },
+	{ "FilledSmallSquare", { 0x25FC, 0x0 }, false },
+	{ "Sqrt", { 0x221A, 0x0 }, false },
+	{ "pre", { 0x2AAF, 0x0 }, false },
+	{ "ufr", { 0x1D532, 0x0 }, false },
+	{ "boxdL", { 0x2555, 0x0 }, false },
+	{ "NotLeftTriangle", { 0x22EA, 0x0 }, false },
+	{ "shortparallel", { 0x2225, 0x0 }, false },
+	{ "epsiv", { 0x3F5, 0x0 }, false },
+	{ "twoheadleftarrow", { 0x219E, 0x0 }, false },
+	{ "Larr", { 0x219E, 0x0 }, false },
+	{ "supseteqq", { 0x2AC6, 0x0 }, false },
+	{ "Gcy", { 0x413, 0x0 }, false },
+	{ "Mellintrf", { 0x2133, 0x0 }, false },
+	{ "Proportional", { 0x221D, 0x0 }, false },
+	{ "leftthreetimes", { 0x22CB, 0x0 }, false },
+	{ "Tstrok", { 0x166, 0x0 }, false },
+	{ "hcirc", { 0x125, 0x0 }, false },
+	{ "half", { 0xBD, 0x0 }, false },
+	{ "yicy", { 0x457, 0x0 }, false },
+	{ "checkmark", { 0x2713, 0x0 }, false },
+	{ "ncaron", { 0x148, 0x0 }, false },
+	{ "eopf", { 0x1D556, 0x0 }, false },
+	{ "smte", { 0x2AAC, 0x0 }, false },
+	{ "nsup", { 0x2285, 0x0 }, false },
+	{ "rbrack", { 0x5D, 0x0 }, false },
+	{ "equiv", { 0x2261, 0x0 }, false },
+	{ "VerticalLine", { 0x7C, 0x0 }, false },
+	{ "ReverseEquilibrium", { 0x21CB, 0x0 }, false },
+	{ "Ccirc", { 0x108, 0x0 }, false },
+	{ "qscr", { 0x1D4C6, 0x0 }, false },
+	{ "forall", { 0x2200, 0x0 }, false },
+	{ "ohbar", { 0x29B5, 0x0 }, false },
+	{ "vert", { 0x7C, 0x0 }, false },
+	{ "NotLessSlantEqual", { 0x2A7D, 0x338 }, false },
+	{ "ngE", { 0x2267, 0x338 }, false },
+	{ "supedot", { 0x2AC4, 0x0 }, false },
+	{ "NotDoubleVerticalBar", { 0x2226, 0x0 }, false },
+	{ "nsubseteqq", { 0x2AC5, 0x338 }, false },
+	{ "lesssim", { 0x2272, 0x0 }, false },
+	{ "leftarrowtail", { 0x21A2, 0x0 }, false },
+	{ "bumpeq", { 0x224F, 0x0 }, false },
+	{ "bigcup", { 0x22C3, 0x0 }, false },
+	{ "lstrok", { 0x142, 0x0 }, false },
+	{ "scnE", { 0x2AB6, 0x0 }, false },
+	{ "eparsl", { 0x29E3, 0x0 }, false },
+	{ "Yscr", { 0x1D4B4, 0x0 }, false },
+	{ "yfr", { 0x1D536, 0x0 }, false },
+	{ "NotGreaterSlantEqual", { 0x2A7E, 0x338 }, false },
+	{ "cire", { 0x2257, 0x0 }, false },
+	{ "timesbar", { 0x2A31, 0x0 }, false },
+	{ "sopf", { 0x1D564, 0x0 }, false },
+	{ "oror", { 0x2A56, 0x0 }, false },
+	{ "rtriltri", { 0x29CE, 0x0 }, false },
+	{ "lrhar", { 0x21CB, 0x0 }, false },
+	{ "Ubrcy", { 0x40E, 0x0 }, false },
+	{ "DiacriticalDot", { 0x2D9, 0x0 }, false },
+	{ "bdquo", { 0x201E, 0x0 }, false },
+	{ "subseteq", { 0x2286, 0x0 }, false },
+	{ "barwedge", { 0x2305, 0x0 }, false },
+	{ "rarrhk", { 0x21AA, 0x0 }, false },
+	{ "RuleDelayed", { 0x29F4, 0x0 }, false },
+	{ "sqsupset", { 0x2290, 0x0 }, false },
+	{ "roplus", { 0x2A2E, 0x0 }, false },
+	{ "ncongdot", { 0x2A6D, 0x338 }, false },
+	{ "in", { 0x2208, 0x0 }, false },
+	{ "Yacute", { 0xDD, 0x0 }, true },
+	{ "Del", { 0x2207, 0x0 }, false },
+	{ "nldr", { 0x2025, 0x0 }, false },
+	{ "operp", { 0x29B9, 0x0 }, false },
+	{ "Ffr", { 0x1D509, 0x0 }, false },
+	{ "veeeq", { 0x225A, 0x0 }, false },
+	{ "block", { 0x2588, 0x0 }, false },
+	{ "urtri", { 0x25F9, 0x0 }, false },
+	{ "angrt", { 0x221F, 0x0 }, false },
+	{ "succnsim", { 0x22E9, 0x0 }, false },
+	{ "emsp13", { 0x2004, 0x0 }, false },
+	{ "prurel", { 0x22B0, 0x0 }, false },
+	{ "Cayleys", { 0x212D, 0x0 }, false },
+	{ "bsolhsub", { 0x27C8, 0x0 }, false },
+	{ "CircleMinus", { 0x2296, 0x0 }, false },
+	{ "subsub", { 0x2AD5, 0x0 }, false },
+	{ "xlArr", { 0x27F8, 0x0 }, false },
+	{ "vzigzag", { 0x299A, 0x0 }, false },
+	{ "nearhk", { 0x2924, 0x0 }, false },
+	{ "capcup", { 0x2A47, 0x0 }, false },
+	{ "wr", { 0x2240, 0x0 }, false },
+	{ "Gscr", { 0x1D4A2, 0x0 }, false },
+	{ "opar", { 0x29B7, 0x0 }, false },
+	{ "simne", { 0x2246, 0x0 }, false },
+	{ "sfr", { 0x1D530, 0x0 }, false },
+	{ "DownTeeArrow", { 0x21A7, 0x0 }, false },
+	{ "Theta", { 0x398, 0x0 }, false },
+	{ "uml", { 0xA8, 0x0 }, true },
+	{ "kcy", { 0x43A, 0x0 }, false },
+	{ "wp", { 0x2118, 0x0 }, false },
+	{ "sub", { 0x2282, 0x0 }, false },
+	{ "UpDownArrow", { 0x2195, 0x0 }, false },
+	{ "frac56", { 0x215A, 0x0 }, false },
+	{ "UpEquilibrium", { 0x296E, 0x0 }, false },
+	{ "Upsi", { 0x3D2, 0x0 }, false },
+	{ "Dot", { 0xA8, 0x0 }, false },
+	{ "OverBar", { 0x203E, 0x0 }, false },
+	{ "and", { 0x2227, 0x0 }, false },
+	{ "mdash", { 0x2014, 0x0 }, false },
+	{ "nexist", { 0x2204, 0x0 }, false },
+	{ "DownLeftRightVector", { 0x2950, 0x0 }, false },
+	{ "dwangle", { 0x29A6, 0x0 }, false },
+	{ "bnequiv", { 0x2261, 0x20E5 }, false },
+	{ "Scy", { 0x421, 0x0 }, false },
+	{ "subseteqq", { 0x2AC5, 0x0 }, false },
+	{ "gescc", { 0x2AA9, 0x0 }, false },
+	{ "subsim", { 0x2AC7, 0x0 }, false },
+	{ "nopf", { 0x1D55F, 0x0 }, false },
+	{ "bot", { 0x22A5, 0x0 }, false },
+	{ "apE", { 0x2A70, 0x0 }, false },
+	{ "Uparrow", { 0x21D1, 0x0 }, false },
+	{ "mp", { 0x2213, 0x0 }, false },
+	{ "dagger", { 0x2020, 0x0 }, false },
+	{ "Cup", { 0x22D3, 0x0 }, false },
+	{ "nsubset", { 0x2282, 0x20D2 }, false },
+	{ "ncap", { 0x2A43, 0x0 }, false },
+	{ "capdot", { 0x2A40, 0x0 }, false },
+	{ "profline", { 0x2312, 0x0 }, false },
+	{ "jsercy", { 0x458, 0x0 }, false },
+	{ "nvsim", { 0x223C, 0x20D2 }, false },
+	{ "tscr", { 0x1D4C9, 0x0 }, false },
+	{ "RightDownTeeVector", { 0x295D, 0x0 }, false },
+	{ "orarr", { 0x21BB, 0x0 }, false },
+	{ "REG", { 0xAE, 0x0 }, true },
+	{ "dHar", { 0x2965, 0x0 }, false },
+	{ "gimel", { 0x2137, 0x0 }, false },
+	{ "mfr", { 0x1D52A, 0x0 }, false },
+	{ "kfr", { 0x1D528, 0x0 }, false },
+	{ "rlm", { 0x200F, 0x0 }, false },
+	{ "lhblk", { 0x2584, 0x0 }, false },
+	{ "prE", { 0x2AB3, 0x0 }, false },
+	{ "yopf", { 0x1D56A, 0x0 }, false },
+	{ "rpar", { 0x29, 0x0 }, false },
+	{ "xotime", { 0x2A02, 0x0 }, false },
+	{ "LeftAngleBracket", { 0x27E8, 0x0 }, false },
+	{ "Oacute", { 0xD3, 0x0 }, true },
+	{ "real", { 0x211C, 0x0 }, false },
+	{ "ddagger", { 0x2021, 0x0 }, false },
+	{ "boxhU", { 0x2568, 0x0 }, false },
+	{ "ulcorner", { 0x231C, 0x0 }, false },
+	{ "drcrop", { 0x230C, 0x0 }, false },
+	{ "Because", { 0x2235, 0x0 }, false },
+	{ "hkswarow", { 0x2926, 0x0 }, false },
+	{ "Vfr", { 0x1D519, 0x0 }, false },
+	{ "SHcy", { 0x428, 0x0 }, false },
+	{ "RightDoubleBracket", { 0x27E7, 0x0 }, false },
+	{ "topfork", { 0x2ADA, 0x0 }, false },
+	{ "DownArrowBar", { 0x2913, 0x0 }, false },
+	{ "LeftUpVector", { 0x21BF, 0x0 }, false },
+	{ "lbbrk", { 0x2772, 0x0 }, false },
+	{ "nvHarr", { 0x2904, 0x0 }, false },
+	{ "Popf", { 0x2119, 0x0 }, false },
+	{ "Jcirc", { 0x134, 0x0 }, false },
+	{ "fllig", { 0xFB02, 0x0 }, false },
+	{ "uopf", { 0x1D566, 0x0 }, false },
+	{ "LeftDownVectorBar", { 0x2959, 0x0 }, false },
+	{ "DownRightVector", { 0x21C1, 0x0 }, false },
+	{ "NotTildeTilde", { 0x2249, 0x0 }, false },
+	{ "simeq", { 0x2243, 0x0 }, false },
+	{ "shcy", { 0x448, 0x0 }, false },
+	{ "nbumpe", { 0x224F, 0x338 }, false },
+	{ "nspar", { 0x2226, 0x0 }, false },
+	{ "wfr", { 0x1D534, 0x0 }, false },
+	{ "LeftTriangle", { 0x22B2, 0x0 }, false },
+	{ "leftrightsquigarrow", { 0x21AD, 0x0 }, false },
+	{ "NotGreater", { 0x226F, 0x0 }, false },
+	{ "NotLeftTriangleEqual", { 0x22EC, 0x0 }, false },
+	{ "hscr", { 0x1D4BD, 0x0 }, false },
+	{ "urcorn", { 0x231D, 0x0 }, false },
+	{ "oelig", { 0x153, 0x0 }, false },
+	{ "lbarr", { 0x290C, 0x0 }, false },
+	{ "ubreve", { 0x16D, 0x0 }, false },
+	{ "wedbar", { 0x2A5F, 0x0 }, false },
+	{ "nGt", { 0x226B, 0x20D2 }, false },
+	{ "nvlt", { 0x3C, 0x20D2 }, false },
+	{ "NotRightTriangleBar", { 0x29D0, 0x338 }, false },
+	{ "nearrow", { 0x2197, 0x0 }, false },
+	{ "larr", { 0x2190, 0x0 }, false },
+	{ "notin", { 0x2209, 0x0 }, false },
+	{ "nLl", { 0x22D8, 0x338 }, false },
+	{ "nless", { 0x226E, 0x0 }, false },
+	{ "curarr", { 0x21B7, 0x0 }, false },
+	{ "Rrightarrow", { 0x21DB, 0x0 }, false },
+	{ "nprec", { 0x2280, 0x0 }, false },
+	{ "Ecirc", { 0xCA, 0x0 }, true },
+	{ "rdldhar", { 0x2969, 0x0 }, false },
+	{ "centerdot", { 0xB7, 0x0 }, false },
+	{ "dfisht", { 0x297F, 0x0 }, false },
+	{ "Ucirc", { 0xDB, 0x0 }, true },
+	{ "rharu", { 0x21C0, 0x0 }, false },
+	{ "Re", { 0x211C, 0x0 }, false },
+	{ "euro", { 0x20AC, 0x0 }, false },
+	{ "ThickSpace", { 0x205F, 0x200A }, false },
+	{ "complement", { 0x2201, 0x0 }, false },
+	{ "Afr", { 0x1D504, 0x0 }, false },
+	{ "vcy", { 0x432, 0x0 }, false },
+	{ "mcomma", { 0x2A29, 0x0 }, false },
+	{ "varpi", { 0x3D6, 0x0 }, false },
+	{ "DoubleDot", { 0xA8, 0x0 }, false },
+	{ "fallingdotseq", { 0x2252, 0x0 }, false },
+	{ "gesdotol", { 0x2A84, 0x0 }, false },
+	{ "circledR", { 0xAE, 0x0 }, false },
+	{ "imagline", { 0x2110, 0x0 }, false },
+	{ "leqq", { 0x2266, 0x0 }, false },
+	{ "mapstoup", { 0x21A5, 0x0 }, false },
+	{ "parallel", { 0x2225, 0x0 }, false },
+	{ "varrho", { 0x3F1, 0x0 }, false },
+	{ "ensp", { 0x2002, 0x0 }, false },
+	{ "updownarrow", { 0x2195, 0x0 }, false },
+	{ "lpar", { 0x28, 0x0 }, false },
+	{ "dArr", { 0x21D3, 0x0 }, false },
+	{ "uplus", { 0x228E, 0x0 }, false },
+	{ "sce", { 0x2AB0, 0x0 }, false },
+	{ "DoubleLongLeftArrow", { 0x27F8, 0x0 }, false },
+	{ "Longleftarrow", { 0x27F8, 0x0 }, false },
+	{ "setmn", { 0x2216, 0x0 }, false },
+	{ "NotRightTriangle", { 0x22EB, 0x0 }, false },
+	{ "THORN", { 0xDE, 0x0 }, true },
+	{ "ForAll", { 0x2200, 0x0 }, false },
+	{ "Vert", { 0x2016, 0x0 }, false },
+	{ "nleftrightarrow", { 0x21AE, 0x0 }, false },
+	{ "nparallel", { 0x2226, 0x0 }, false },
+	{ "Ubreve", { 0x16C, 0x0 }, false },
+	{ "xscr", { 0x1D4CD, 0x0 }, false },
+	{ "quot", { 0x22, 0x0 }, true },
+	{ "Gcedil", { 0x122, 0x0 }, false },
+	{ "Euml", { 0xCB, 0x0 }, true },
+	{ "Hat", { 0x5E, 0x0 }, false },
+	{ "vartriangleleft", { 0x22B2, 0x0 }, false },
+	{ "LeftArrowRightArrow", { 0x21C6, 0x0 }, false },
+	{ "mnplus", { 0x2213, 0x0 }, false },
+	{ "Lcaron", { 0x13D, 0x0 }, false },
+	{ "ncong", { 0x2247, 0x0 }, false },
+	{ "nsupE", { 0x2AC6, 0x338 }, false },
+	{ "Diamond", { 0x22C4, 0x0 }, false },
+	{ "RightTeeVector", { 0x295B, 0x0 }, false },
+	{ "gla", { 0x2AA5, 0x0 }, false },
+	{ "af", { 0x2061, 0x0 }, false },
+	{ "zdot", { 0x17C, 0x0 }, false },
+	{ "plusmn", { 0xB1, 0x0 }, true },
+	{ "olt", { 0x29C0, 0x0 }, false },
+	{ "LowerLeftArrow", { 0x2199, 0x0 }, false },
+	{ "curlyeqprec", { 0x22DE, 0x0 }, false },
+	{ "hArr", { 0x21D4, 0x0 }, false },
+	{ "equest", { 0x225F, 0x0 }, false },
+	{ "Gbreve", { 0x11E, 0x0 }, false },
+	{ "glj", { 0x2AA4, 0x0 }, false },
+	{ "lessgtr", { 0x2276, 0x0 }, false },
+	{ "tau", { 0x3C4, 0x0 }, false },
+	{ "simgE", { 0x2AA0, 0x0 }, false },
+	{ "scpolint", { 0x2A13, 0x0 }, false },
+	{ "sol", { 0x2F, 0x0 }, false },
+	{ "Efr", { 0x1D508, 0x0 }, false },
+	{ "ogt", { 0x29C1, 0x0 }, false },
+	{ "Aogon", { 0x104, 0x0 }, false },
+	{ "wscr", { 0x1D4CC, 0x0 }, false },
+	{ "simplus", { 0x2A24, 0x0 }, false },
+	{ "infin", { 0x221E, 0x0 }, false },
+	{ "ccaron", { 0x10D, 0x0 }, false },
+	{ "gtreqqless", { 0x2A8C, 0x0 }, false },
+	{ "Ncedil", { 0x145, 0x0 }, false },
+	{ "gtreqless", { 0x22DB, 0x0 }, false },
+	{ "nGg", { 0x22D9, 0x338 }, false },
+	{ "image", { 0x2111, 0x0 }, false },
+	{ "Uogon", { 0x172, 0x0 }, false },
+	{ "lrtri", { 0x22BF, 0x0 }, false },
+	{ "ZHcy", { 0x416, 0x0 }, false },
+	{ "Zeta", { 0x396, 0x0 }, false },
+	{ "midcir", { 0x2AF0, 0x0 }, false },
+	{ "strns", { 0xAF, 0x0 }, false },
+	{ "DJcy", { 0x402, 0x0 }, false },
+	{ "cwint", { 0x2231, 0x0 }, false },
+	{ "propto", { 0x221D, 0x0 }, false },
+	{ "SquareUnion", { 0x2294, 0x0 }, false },
+	{ "rightsquigarrow", { 0x219D, 0x0 }, false },
+	{ "ApplyFunction", { 0x2061, 0x0 }, false },
+	{ "Backslash", { 0x2216, 0x0 }, false },
+	{ "nwArr", { 0x21D6, 0x0 }, false },
+	{ "sigmav", { 0x3C2, 0x0 }, false },
+	{ "ap", { 0x2248, 0x0 }, false },
+	{ "gl", { 0x2277, 0x0 }, false },
+	{ "capbrcup", { 0x2A49, 0x0 }, false },
+	{ "Jopf", { 0x1D541, 0x0 }, false },
+	{ "downharpoonleft", { 0x21C3, 0x0 }, false },
+	{ "bcy", { 0x431, 0x0 }, false },
+	{ "gdot", { 0x121, 0x0 }, false },
+	{ "jmath", { 0x237, 0x0 }, false },
+	{ "iacute", { 0xED, 0x0 }, true },
+	{ "LT", { 0x3C, 0x0 }, true },
+	{ "lates", { 0x2AAD, 0xFE00 }, false },
+	{ "afr", { 0x1D51E, 0x0 }, false },
+	{ "UnionPlus", { 0x228E, 0x0 }, false },
+	{ "gtrarr", { 0x2978, 0x0 }, false },
+	{ "varpropto", { 0x221D, 0x0 }, false },
+	{ "nsube", { 0x2288, 0x0 }, false },
+	{ "ograve", { 0xF2, 0x0 }, true },
+	{ "Subset", { 0x22D0, 0x0 }, false },
+	{ "disin", { 0x22F2, 0x0 }, false },
+	{ "tstrok", { 0x167, 0x0 }, false },
+	{ "ascr", { 0x1D4B6, 0x0 }, false },
+	{ "suphsol", { 0x27C9, 0x0 }, false },
+	{ "udhar", { 0x296E, 0x0 }, false },
+	{ "lap", { 0x2A85, 0x0 }, false },
+	{ "lcedil", { 0x13C, 0x0 }, false },
+	{ "Jcy", { 0x419, 0x0 }, false },
+	{ "NotSquareSupersetEqual", { 0x22E3, 0x0 }, false },
+	{ "sscr", { 0x1D4C8, 0x0 }, false },
+	{ "grave", { 0x60, 0x0 }, false },
+	{ "kopf", { 0x1D55C, 0x0 }, false },
+	{ "Rang", { 0x27EB, 0x0 }, false },
+	{ "nvap", { 0x224D, 0x20D2 }, false },
+	{ "boxv", { 0x2502, 0x0 }, false },
+	{ "andslope", { 0x2A58, 0x0 }, false },
+	{ "LeftCeiling", { 0x2308, 0x0 }, false },
+	{ "natur", { 0x266E, 0x0 }, false },
+	{ "ltlarr", { 0x2976, 0x0 }, false },
+	{ "zwj", { 0x200D, 0x0 }, false },
+	{ "ExponentialE", { 0x2147, 0x0 }, false },
+	{ "delta", { 0x3B4, 0x0 }, false },
+	{ "Vdash", { 0x22A9, 0x0 }, false },
+	{ "thinsp", { 0x2009, 0x0 }, false },
+	{ "Yopf", { 0x1D550, 0x0 }, false },
+	{ "nisd", { 0x22FA, 0x0 }, false },
+	{ "precnsim", { 0x22E8, 0x0 }, false },
+	{ "nvlArr", { 0x2902, 0x0 }, false },
+	{ "nlE", { 0x2266, 0x338 }, false },
+	{ "iinfin", { 0x29DC, 0x0 }, false },
+	{ "nsim", { 0x2241, 0x0 }, false },
+	{ "odblac", { 0x151, 0x0 }, false },
+	{ "TSHcy", { 0x40B, 0x0 }, false },
+	{ "gEl", { 0x2A8C, 0x0 }, false },
+	{ "preccurlyeq", { 0x227C, 0x0 }, false },
+	{ "ltrif", { 0x25C2, 0x0 }, false },
+	{ "pcy", { 0x43F, 0x0 }, false },
+	{ "robrk", { 0x27E7, 0x0 }, false },
+	{ "vartheta", { 0x3D1, 0x0 }, false },
+	{ "trade", { 0x2122, 0x0 }, false },
+	{ "Otimes", { 0x2A37, 0x0 }, false },
+	{ "VerticalSeparator", { 0x2758, 0x0 }, false },
+	{ "tshcy", { 0x45B, 0x0 }, false },
+	{ "cupbrcap", { 0x2A48, 0x0 }, false },
+	{ "NJcy", { 0x40A, 0x0 }, false },
+	{ "demptyv", { 0x29B1, 0x0 }, false },
+	{ "NotSubsetEqual", { 0x2288, 0x0 }, false },
+	{ "ge", { 0x2265, 0x0 }, false },
+	{ "nis", { 0x22FC, 0x0 }, false },
+	{ "xrarr", { 0x27F6, 0x0 }, false },
+	{ "DownBreve", { 0x311, 0x0 }, false },
+	{ "orv", { 0x2A5B, 0x0 }, false },
+	{ "Breve", { 0x2D8, 0x0 }, false },
+	{ "angmsdad", { 0x29AB, 0x0 }, false },
+	{ "DZcy", { 0x40F, 0x0 }, false },
+	{ "eqvparsl", { 0x29E5, 0x0 }, false },
+	{ "DownArrow", { 0x2193, 0x0 }, false },
+	{ "frasl", { 0x2044, 0x0 }, false },
+	{ "par", { 0x2225, 0x0 }, false },
+	{ "Ograve", { 0xD2, 0x0 }, true },
+	{ "pluscir", { 0x2A22, 0x0 }, false },
+	{ "sup2", { 0xB2, 0x0 }, true },
+	{ "rbrksld", { 0x298E, 0x0 }, false },
+	{ "smile", { 0x2323, 0x0 }, false },
+	{ "hbar", { 0x210F, 0x0 }, false },
+	{ "DoubleVerticalBar", { 0x2225, 0x0 }, false },
+	{ "boxHD", { 0x2566, 0x0 }, false },
+	{ "Bfr", { 0x1D505, 0x0 }, false },
+	{ "SuchThat", { 0x220B, 0x0 }, false },
+	{ "SquareSubset", { 0x228F, 0x0 }, false },
+	{ "Dopf", { 0x1D53B, 0x0 }, false },
+	{ "boxvr", { 0x251C, 0x0 }, false },
+	{ "cap", { 0x2229, 0x0 }, false },
+	{ "Laplacetrf", { 0x2112, 0x0 }, false },
+	{ "xrArr", { 0x27F9, 0x0 }, false },
+	{ "sect", { 0xA7, 0x0 }, true },
+	{ "hyphen", { 0x2010, 0x0 }, false },
+	{ "lscr", { 0x1D4C1, 0x0 }, false },
+	{ "NotSupersetEqual", { 0x2289, 0x0 }, false },
+	{ "Scirc", { 0x15C, 0x0 }, false },
+	{ "leftleftarrows", { 0x21C7, 0x0 }, false },
+	{ "PartialD", { 0x2202, 0x0 }, false },
+	{ "dscy", { 0x455, 0x0 }, false },
+	{ "isin", { 0x2208, 0x0 }, false },
+	{ "thorn", { 0xFE, 0x0 }, true },
+	{ "abreve", { 0x103, 0x0 }, false },
+	{ "upsi", { 0x3C5, 0x0 }, false },
+	{ "epsi", { 0x3B5, 0x0 }, false },
+	{ "thksim", { 0x223C, 0x0 }, false },
+	{ "Equilibrium", { 0x21CC, 0x0 }, false },
+	{ "boxuL", { 0x255B, 0x0 }, false },
+	{ "ddarr", { 0x21CA, 0x0 }, false },
+	{ "Rsh", { 0x21B1, 0x0 }, false },
+	{ "SupersetEqual", { 0x2287, 0x0 }, false },
+	{ "Pcy", { 0x41F, 0x0 }, false },
+	{ "rarrc", { 0x2933, 0x0 }, false },
+	{ "boxHu", { 0x2567, 0x0 }, false },
+	{ "ggg", { 0x22D9, 0x0 }, false },
+	{ "blacktriangleleft", { 0x25C2, 0x0 }, false },
+	{ "zcaron", { 0x17E, 0x0 }, false },
+	{ "nacute", { 0x144, 0x0 }, false },
+	{ "ulcorn", { 0x231C, 0x0 }, false },
+	{ "otimesas", { 0x2A36, 0x0 }, false },
+	{ "ShortLeftArrow", { 0x2190, 0x0 }, false },
+	{ "Tfr", { 0x1D517, 0x0 }, false },
+	{ "Delta", { 0x394, 0x0 }, false },
+	{ "lozenge", { 0x25CA, 0x0 }, false },
+	{ "lmoust", { 0x23B0, 0x0 }, false },
+	{ "Tilde", { 0x223C, 0x0 }, false },
+	{ "Barwed", { 0x2306, 0x0 }, false },
+	{ "geqq", { 0x2267, 0x0 }, false },
+	{ "Imacr", { 0x12A, 0x0 }, false },
+	{ "xwedge", { 0x22C0, 0x0 }, false },
+	{ "preceq", { 0x2AAF, 0x0 }, false },
+	{ "ycirc", { 0x177, 0x0 }, false },
+	{ "Omicron", { 0x39F, 0x0 }, false },
+	{ "Tcy", { 0x422, 0x0 }, false },
+	{ "bigwedge", { 0x22C0, 0x0 }, false },
+	{ "PlusMinus", { 0xB1, 0x0 }, false },
+	{ "it", { 0x2062, 0x0 }, false },
+	{ "NotSquareSuperset", { 0x2290, 0x338 }, false },
+	{ "planckh", { 0x210E, 0x0 }, false },
+	{ "comma", { 0x2C, 0x0 }, false },
+	{ "ntriangleright", { 0x22EB, 0x0 }, false },
+	{ "UpperLeftArrow", { 0x2196, 0x0 }, false },
+	{ "bne", { 0x3D, 0x20E5 }, false },
+	{ "nscr", { 0x1D4C3, 0x0 }, false },
+	{ "backcong", { 0x224C, 0x0 }, false },
+	{ "frac18", { 0x215B, 0x0 }, false },
+	{ "DotDot", { 0x20DC, 0x0 }, false },
+	{ "LeftVectorBar", { 0x2952, 0x0 }, false },
+	{ "Xi", { 0x39E, 0x0 }, false },
+	{ "Zfr", { 0x2128, 0x0 }, false },
+	{ "vee", { 0x2228, 0x0 }, false },
+	{ "Oscr", { 0x1D4AA, 0x0 }, false },
+	{ "NotSucceedsEqual", { 0x2AB0, 0x338 }, false },
+	{ "Lang", { 0x27EA, 0x0 }, false },
+	{ "mDDot", { 0x223A, 0x0 }, false },
+	{ "bigstar", { 0x2605, 0x0 }, false },
+	{ "els", { 0x2A95, 0x0 }, false },
+	{ "kgreen", { 0x138, 0x0 }, false },
+	{ "lesdot", { 0x2A7F, 0x0 }, false },
+	{ "angrtvbd", { 0x299D, 0x0 }, false },
+	{ "boxbox", { 0x29C9, 0x0 }, false },
+	{ "maltese", { 0x2720, 0x0 }, false },
+	{ "cuvee", { 0x22CE, 0x0 }, false },
+	{ "rightthreetimes", { 0x22CC, 0x0 }, false },
+	{ "Implies", { 0x21D2, 0x0 }, false },
+	{ "Xfr", { 0x1D51B, 0x0 }, false },
+	{ "nrarr", { 0x219B, 0x0 }, false },
+	{ "efDot", { 0x2252, 0x0 }, false },
+	{ "oopf", { 0x1D560, 0x0 }, false },
+	{ "xlarr", { 0x27F5, 0x0 }, false },
+	{ "Dcaron", { 0x10E, 0x0 }, false },
+	{ "LeftTriangleBar", { 0x29CF, 0x0 }, false },
+	{ "ovbar", { 0x233D, 0x0 }, false },
+	{ "dotminus", { 0x2238, 0x0 }, false },
+	{ "ncedil", { 0x146, 0x0 }, false },
+	{ "boxvh", { 0x253C, 0x0 }, false },
+	{ "HilbertSpace", { 0x210B, 0x0 }, false },
+	{ "gsim", { 0x2273, 0x0 }, false },
+	{ "kappav", { 0x3F0, 0x0 }, false },
+	{ "starf", { 0x2605, 0x0 }, false },
+	{ "Assign", { 0x2254, 0x0 }, false },
+	{ "rcy", { 0x440, 0x0 }, false },
+	{ "timesd", { 0x2A30, 0x0 }, false },
+	{ "sigma", { 0x3C3, 0x0 }, false },
+	{ "ofr", { 0x1D52C, 0x0 }, false },
+	{ "npart", { 0x2202, 0x338 }, false },
+	{ "vellip", { 0x22EE, 0x0 }, false },
+	{ "CHcy", { 0x427, 0x0 }, false },
+	{ "approx", { 0x2248, 0x0 }, false },
+	{ "varepsilon", { 0x3F5, 0x0 }, false },
+	{ "blacktriangle", { 0x25B4, 0x0 }, false },
+	{ "GreaterSlantEqual", { 0x2A7E, 0x0 }, false },
+	{ "intcal", { 0x22BA, 0x0 }, false },
+	{ "beth", { 0x2136, 0x0 }, false },
+	{ "plus", { 0x2B, 0x0 }, false },
+	{ "LeftTee", { 0x22A3, 0x0 }, false },
+	{ "lparlt", { 0x2993, 0x0 }, false },
+	{ "nwarrow", { 0x2196, 0x0 }, false },
+	{ "tbrk", { 0x23B4, 0x0 }, false },
+	{ "NotSucceedsTilde", { 0x227F, 0x338 }, false },
+	{ "popf", { 0x1D561, 0x0 }, false },
+	{ "curarrm", { 0x293C, 0x0 }, false },
+	{ "NotPrecedesSlantEqual", { 0x22E0, 0x0 }, false },
+	{ "naturals", { 0x2115, 0x0 }, false },
+	{ "And", { 0x2A53, 0x0 }, false },
+	{ "leq", { 0x2264, 0x0 }, false },
+	{ "cong", { 0x2245, 0x0 }, false },
+	{ "sqsub", { 0x228F, 0x0 }, false },
+	{ "notinvb", { 0x22F7, 0x0 }, false },
+	{ "timesb", { 0x22A0, 0x0 }, false },
+	{ "ugrave", { 0xF9, 0x0 }, true },
+	{ "Colon", { 0x2237, 0x0 }, false },
+	{ "rfloor", { 0x230B, 0x0 }, false },
+	{ "Ugrave", { 0xD9, 0x0 }, true },
+	{ "LeftDoubleBracket", { 0x27E6, 0x0 }, false },
+	{ "subedot", { 0x2AC3, 0x0 }, false },
+	{ "bigoplus", { 0x2A01, 0x0 }, false },
+	{ "rarrsim", { 0x2974, 0x0 }, false },
+	{ "supe", { 0x2287, 0x0 }, false },
+	{ "Im", { 0x2111, 0x0 }, false },
+	{ "sube", { 0x2286, 0x0 }, false },
+	{ "IEcy", { 0x415, 0x0 }, false },
+	{ "caret", { 0x2041, 0x0 }, false },
+	{ "larrhk", { 0x21A9, 0x0 }, false },
+	{ "napid", { 0x224B, 0x338 }, false },
+	{ "nsubE", { 0x2AC5, 0x338 }, false },
+	{ "urcrop", { 0x230E, 0x0 }, false },
+	{ "nprcue", { 0x22E0, 0x0 }, false },
+	{ "sdotb", { 0x22A1, 0x0 }, false },
+	{ "Lfr", { 0x1D50F, 0x0 }, false },
+	{ "sccue", { 0x227D, 0x0 }, false },
+	{ "ngeqq", { 0x2267, 0x338 }, false },
+	{ "mho", { 0x2127, 0x0 }, false },
+	{ "midast", { 0x2A, 0x0 }, false },
+	{ "DownArrowUpArrow", { 0x21F5, 0x0 }, false },
+	{ "incare", { 0x2105, 0x0 }, false },
+	{ "ac", { 0x223E, 0x0 }, false },
+	{ "hybull", { 0x2043, 0x0 }, false },
+	{ "bigvee", { 0x22C1, 0x0 }, false },
+	{ "NotGreaterLess", { 0x2279, 0x0 }, false },
+	{ "rbbrk", { 0x2773, 0x0 }, false },
+	{ "oint", { 0x222E, 0x0 }, false },
+	{ "precsim", { 0x227E, 0x0 }, false },
+	{ "macr", { 0xAF, 0x0 }, true },
+	{ "Lcy", { 0x41B, 0x0 }, false },
+	{ "ocir", { 0x229A, 0x0 }, false },
+	{ "circledcirc", { 0x229A, 0x0 }, false },
+	{ "boxVh", { 0x256B, 0x0 }, false },
+	{ "awint", { 0x2A11, 0x0 }, false },
+	{ "mumap", { 0x22B8, 0x0 }, false },
+	{ "Xopf", { 0x1D54F, 0x0 }, false },
+	{ "male", { 0x2642, 0x0 }, false },
+	{ "iiint", { 0x222D, 0x0 }, false },
+	{ "measuredangle", { 0x2221, 0x0 }, false },
+	{ "notinE", { 0x22F9, 0x338 }, false },
+	{ "suphsub", { 0x2AD7, 0x0 }, false },
+	{ "ffllig", { 0xFB04, 0x0 }, false },
+	{ "fflig", { 0xFB00, 0x0 }, false },
+	{ "agrave", { 0xE0, 0x0 }, true },
+	{ "DownRightVectorBar", { 0x2957, 0x0 }, false },
+	{ "Oopf", { 0x1D546, 0x0 }, false },
+	{ "Wcirc", { 0x174, 0x0 }, false },
+	{ "nhArr", { 0x21CE, 0x0 }, false },
+	{ "auml", { 0xE4, 0x0 }, true },
+	{ "xcup", { 0x22C3, 0x0 }, false },
+	{ "rceil", { 0x2309, 0x0 }, false },
+	{ "eqcirc", { 0x2256, 0x0 }, false },
+	{ "blk12", { 0x2592, 0x0 }, false },
+	{ "gvnE", { 0x2269, 0xFE00 }, false },
+	{ "upuparrows", { 0x21C8, 0x0 }, false },
+	{ "because", { 0x2235, 0x0 }, false },
+	{ "Updownarrow", { 0x21D5, 0x0 }, false },
+	{ "Downarrow", { 0x21D3, 0x0 }, false },
+	{ "looparrowright", { 0x21AC, 0x0 }, false },
+	{ "harrw", { 0x21AD, 0x0 }, false },
+	{ "succ", { 0x227B, 0x0 }, false },
+	{ "SOFTcy", { 0x42C, 0x0 }, false },
+	{ "tfr", { 0x1D531, 0x0 }, false },
+	{ "cudarrl", { 0x2938, 0x0 }, false },
+	{ "gtrapprox", { 0x2A86, 0x0 }, false },
+	{ "DiacriticalTilde", { 0x2DC, 0x0 }, false },
+	{ "cross", { 0x2717, 0x0 }, false },
+	{ "Omacr", { 0x14C, 0x0 }, false },
+	{ "cularrp", { 0x293D, 0x0 }, false },
+	{ "boxplus", { 0x229E, 0x0 }, false },
+	{ "realpart", { 0x211C, 0x0 }, false },
+	{ "ssmile", { 0x2323, 0x0 }, false },
+	{ "doublebarwedge", { 0x2306, 0x0 }, false },
+	{ "nGtv", { 0x226B, 0x338 }, false },
+	{ "prnsim", { 0x22E8, 0x0 }, false },
+	{ "varsubsetneqq", { 0x2ACB, 0xFE00 }, false },
+	{ "TildeEqual", { 0x2243, 0x0 }, false },
+	{ "Vscr", { 0x1D4B1, 0x0 }, false },
+	{ "Darr", { 0x21A1, 0x0 }, false },
+	{ "curren", { 0xA4, 0x0 }, true },
+	{ "RightUpDownVector", { 0x294F, 0x0 }, false },
+	{ "tscy", { 0x446, 0x0 }, false },
+	{ "Sum", { 0x2211, 0x0 }, false },
+	{ "nvrtrie", { 0x22B5, 0x20D2 }, false },
+	{ "DotEqual", { 0x2250, 0x0 }, false },
+	{ "Oslash", { 0xD8, 0x0 }, true },
+	{ "angst", { 0xC5, 0x0 }, false },
+	{ "Bumpeq", { 0x224E, 0x0 }, false },
+	{ "cups", { 0x222A, 0xFE00 }, false },
+	{ "Nopf", { 0x2115, 0x0 }, false },
+	{ "jcy", { 0x439, 0x0 }, false },
+	{ "phmmat", { 0x2133, 0x0 }, false },
+	{ "prnE", { 0x2AB5, 0x0 }, false },
+	{ "VDash", { 0x22AB, 0x0 }, false },
+	{ "DiacriticalAcute", { 0xB4, 0x0 }, false },
+	{ "angmsdab", { 0x29A9, 0x0 }, false },
+	{ "kjcy", { 0x45C, 0x0 }, false },
+	{ "prcue", { 0x227C, 0x0 }, false },
+	{ "spar", { 0x2225, 0x0 }, false },
+	{ "Icirc", { 0xCE, 0x0 }, true },
+	{ "zfr", { 0x1D537, 0x0 }, false },
+	{ "colone", { 0x2254, 0x0 }, false },
+	{ "ffilig", { 0xFB03, 0x0 }, false },
+	{ "nsubseteq", { 0x2288, 0x0 }, false },
+	{ "nLt", { 0x226A, 0x20D2 }, false },
+	{ "rarrb", { 0x21E5, 0x0 }, false },
+	{ "exponentiale", { 0x2147, 0x0 }, false },
+	{ "coprod", { 0x2210, 0x0 }, false },
+	{ "hercon", { 0x22B9, 0x0 }, false },
+	{ "rotimes", { 0x2A35, 0x0 }, false },
+	{ "Rarrtl", { 0x2916, 0x0 }, false },
+	{ "blacktriangledown", { 0x25BE, 0x0 }, false },
+	{ "nharr", { 0x21AE, 0x0 }, false },
+	{ "UnderBrace", { 0x23DF, 0x0 }, false },
+	{ "Ifr", { 0x2111, 0x0 }, false },
+	{ "Rcy", { 0x420, 0x0 }, false },
+	{ "Wopf", { 0x1D54E, 0x0 }, false },
+	{ "spadesuit", { 0x2660, 0x0 }, false },
+	{ "Fouriertrf", { 0x2131, 0x0 }, false },
+	{ "Cdot", { 0x10A, 0x0 }, false },
+	{ "utrif", { 0x25B4, 0x0 }, false },
+	{ "gesdoto", { 0x2A82, 0x0 }, false },
+	{ "ocirc", { 0xF4, 0x0 }, true },
+	{ "xoplus", { 0x2A01, 0x0 }, false },
+	{ "pm", { 0xB1, 0x0 }, false },
+	{ "bigcap", { 0x22C2, 0x0 }, false },
+	{ "rdca", { 0x2937, 0x0 }, false },
+	{ "Hfr", { 0x210C, 0x0 }, false },
+	{ "COPY", { 0xA9, 0x0 }, true },
+	{ "RightUpVector", { 0x21BE, 0x0 }, false },
+	{ "thkap", { 0x2248, 0x0 }, false },
+	{ "Cedilla", { 0xB8, 0x0 }, false },
+	{ "prop", { 0x221D, 0x0 }, false },
+	{ "mapstodown", { 0x21A7, 0x0 }, false },
+	{ "prime", { 0x2032, 0x0 }, false },
+	{ "ring", { 0x2DA, 0x0 }, false },
+	{ "square", { 0x25A1, 0x0 }, false },
+	{ "ReverseElement", { 0x220B, 0x0 }, false },
+	{ "malt", { 0x2720, 0x0 }, false },
+	{ "questeq", { 0x225F, 0x0 }, false },
+	{ "nrarrw", { 0x219D, 0x338 }, false },
+	{ "Cconint", { 0x2230, 0x0 }, false },
+	{ "cylcty", { 0x232D, 0x0 }, false },
+	{ "cemptyv", { 0x29B2, 0x0 }, false },
+	{ "Emacr", { 0x112, 0x0 }, false },
+	{ "nrarrc", { 0x2933, 0x338 }, false },
+	{ "boxdR", { 0x2552, 0x0 }, false },
+	{ "nltri", { 0x22EA, 0x0 }, false },
+	{ "Ropf", { 0x211D, 0x0 }, false },
+	{ "CenterDot", { 0xB7, 0x0 }, false },
+	{ "NotReverseElement", { 0x220C, 0x0 }, false },
+	{ "ldsh", { 0x21B2, 0x0 }, false },
+	{ "leqslant", { 0x2A7D, 0x0 }, false },
+	{ "doteq", { 0x2250, 0x0 }, false },
+	{ "YIcy", { 0x407, 0x0 }, false },
+	{ "rhard", { 0x21C1, 0x0 }, false },
+	{ "sbquo", { 0x201A, 0x0 }, false },
+	{ "rx", { 0x211E, 0x0 }, false },
+	{ "InvisibleComma", { 0x2063, 0x0 }, false },
+	{ "aogon", { 0x105, 0x0 }, false },
+	{ "odash", { 0x229D, 0x0 }, false },
+	{ "csube", { 0x2AD1, 0x0 }, false },
+	{ "nltrie", { 0x22EC, 0x0 }, false },
+	{ "NotSquareSubset", { 0x228F, 0x338 }, false },
+	{ "LessSlantEqual", { 0x2A7D, 0x0 }, false },
+	{ "percnt", { 0x25, 0x0 }, false },
+	{ "solbar", { 0x233F, 0x0 }, false },
+	{ "minusb", { 0x229F, 0x0 }, false },
+	{ "CircleTimes", { 0x2297, 0x0 }, false },
+	{ "intercal", { 0x22BA, 0x0 }, false },
+	{ "nequiv", { 0x2262, 0x0 }, false },
+	{ "UpArrowDownArrow", { 0x21C5, 0x0 }, false },
+	{ "RightTriangleBar", { 0x29D0, 0x0 }, false },
+	{ "ImaginaryI", { 0x2148, 0x0 }, false },
+	{ "race", { 0x223D, 0x331 }, false },
+	{ "Uring", { 0x16E, 0x0 }, false },
+	{ "lnsim", { 0x22E6, 0x0 }, false },
+	{ "ntriangleleft", { 0x22EA, 0x0 }, false },
+};
+
+HtmlEntity const* find_html_entity(char const* begin, char const* end)
+{
+	if (begin == end) return 0;
+
+	guint32 seed = seeds[entity_hash(begin, end, 0) % bucket_count];
+	HtmlEntity const* entity =
+		&entities[entity_hash(begin, end, seed) % entity_count];
+
+	size_t len = end - begin;
+	if (strncmp(entity->name, begin, len) != 0 ||
+	    entity->name[len] != '\0') return 0;
+	return entity;
+}
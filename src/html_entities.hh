@@ -0,0 +1,49 @@
+/* Copyright (C) Pauli Virtanen
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *********************************************************************************/
+
+/**
+ * @file html_entities.hh
+ *
+ * The named character references of HTML5.
+ */
+#ifndef HTML_ENTITIES_HH_
+#define HTML_ENTITIES_HH_
+
+#include <glib.h>
+
+/**
+ * A named character reference, such as &auml; or &NotEqualTilde;.
+ */
+struct HtmlEntity
+{
+	/// The name, without the & and the ;
+	char const* name;
+
+	/// The one or two characters it stands for; the second may be 0
+	gunichar chars[2];
+
+	/// May the ; be left out, as in &auml
+	bool legacy;
+};
+
+/**
+ * Find the entity with the name [begin, end), given without the & and
+ * the ;. Return 0 if there is no such entity.
+ */
+HtmlEntity const* find_html_entity(char const* begin, char const* end);
+
+#endif // HTML_ENTITIES_HH_
@@ -0,0 +1,136 @@
+/* Copyright (C) Pauli Virtanen
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *********************************************************************************/
+
+/**
+ * @file json_writer.cc
+ *
+ * Writing JSON Lines records.
+ */
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <stdio.h>
+#include <string.h>
+#include <glib.h>
+
+#include "json_writer.hh"
+
+void JsonWriter::begin(char const* type)
+{
+	buf_ += '{';
+	first_ = true;
+	field("type", type);
+}
+
+void JsonWriter::key(char const* name)
+{
+	if (!first_) buf_ += ',';
+	first_ = false;
+	buf_ += '"';
+	buf_ += name;
+	buf_ += "\":";
+}
+
+/**
+ * Write a string, escaping quotes, backslashes and control characters.
+ * Valid UTF-8 is copied as it is.
+ */
+void JsonWriter::string(char const* str, size_t len)
+{
+	char const* end = str + len;
+
+	buf_ += '"';
+	while (str < end) {
+		// Copy the longest run needing no escapes
+		char const* run = str;
+		while (run < end && (unsigned char)*run >= 0x20 &&
+		       *run != '"' && *run != '\\' &&
+		       (unsigned char)*run < 0x80) ++run;
+		buf_.append(str, run);
+		str = run;
+		if (str == end) break;
+
+		unsigned char c = *str;
+		if (c >= 0x80) {
+			char const* valid_end;
+			g_utf8_validate(str, end - str, &valid_end);
+			if (valid_end == str) {
+				buf_ += "\xef\xbf\xbd"; // U+FFFD
+				++str;
+			} else {
+				buf_.append(str, valid_end);
+				str = valid_end;
+			}
+			continue;
+		}
+
+		switch (c) {
+		case '"': buf_ += "\\\""; break;
+		case '\\': buf_ += "\\\\"; break;
+		case '\n': buf_ += "\\n"; break;
+		case '\r': buf_ += "\\r"; break;
+		case '\t': buf_ += "\\t"; break;
+		default: {
+			char esc[8];
+			snprintf(esc, sizeof(esc), "\\u%04x", c);
+			buf_ += esc;
+		} break;
+		}
+		++str;
+	}
+	buf_ += '"';
+}
+
+void JsonWriter::field(char const* name, char const* str, size_t len)
+{
+	key(name);
+	string(str, len);
+}
+
+void JsonWriter::field(char const* name, unsigned long n)
+{
+	char num[32];
+	snprintf(num, sizeof(num), "%lu", n);
+	key(name);
+	buf_ += num;
+}
+
+void JsonWriter::field(char const* name,
+		       std::vector<Glib::ustring> const& strs)
+{
+	key(name);
+	buf_ += '[';
+	std::vector<Glib::ustring>::const_iterator i;
+	for (i = strs.begin(); i != strs.end(); ++i) {
+		if (i != strs.begin()) buf_ += ',';
+		string(i->data(), i->bytes());
+	}
+	buf_ += ']';
+}
+
+void JsonWriter::end()
+{
+	buf_ += "}\n";
+}
+
+void JsonWriter::flush(std::ostream& out)
+{
+	out.write(buf_.data(), buf_.size());
+	out.flush();
+	buf_.clear();
+}
@@ -0,0 +1,91 @@
+/* Copyright (C) Pauli Virtanen
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *********************************************************************************/
+
+/**
+ * @file json_writer.hh
+ *
+ * Writing JSON Lines records.
+ */
+#ifndef JSON_WRITER_HH_
+#define JSON_WRITER_HH_
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include <string.h>
+
+#include "glibmm/ustring.h"
+
+/**
+ * Builds JSON Lines records, one object per line, in a buffer. Strings are
+ * written as UTF-8; invalid bytes are replaced with U+FFFD.
+ */
+class JsonWriter
+{
+public:
+	JsonWriter() : buf_(), first_(true) {}
+
+	/// Start a record with the given "type" field
+	void begin(char const* type);
+
+	/// Write a string field
+	void field(char const* name, char const* str, size_t len);
+	void field(char const* name, char const* str)
+		{ field(name, str, strlen(str)); }
+	void field(char const* name, std::string const& str)
+		{ field(name, str.data(), str.size()); }
+	void field(char const* name, Glib::ustring const& str)
+		{ field(name, str.data(), str.bytes()); }
+
+	/// Write a number field
+	void field(char const* name, unsigned long n);
+
+	/// Write an array of strings
+	void field(char const* name, std::vector<Glib::ustring> const& strs);
+
+	/// End the record
+	void end();
+
+	/// The records written so far
+	std::string& buffer() { return buf_; }
+
+	/// Write the records to out, and empty the buffer
+	void flush(std::ostream& out);
+
+	/// Flush, if much has been written
+	void flush_if_full(std::ostream& out)
+		{ if (buf_.size() >= flush_size) flush(out); }
+
+private:
+	/// The size of the buffer to flush at
+	enum { flush_size = 65536 };
+
+	/// Write the name of a field
+	void key(char const* name);
+
+	/// Write a quoted string
+	void string(char const* str, size_t len);
+
+	/// The records
+	std::string buf_;
+
+	/// Is the next field the first in the record
+	bool first_;
+};
+
+#endif // JSON_WRITER_HH_
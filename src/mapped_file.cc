@@ -0,0 +1,223 @@
+/* Copyright (C) Pauli Virtanen
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *********************************************************************************/
+
+/**
+ * @file mapped_file.cc
+ *
+ * Reading whole files through a memory mapping.
+ */
+#include <string>
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "config.hh"
+
+#ifdef HAVE_SYS_SENDFILE_H
+#include <sys/sendfile.h>
+#endif
+
+#include "i18n.hh"
+#include "tmerror.hh"
+#include "mapped_file.hh"
+
+/**
+ * Map the named file. Files that are not regular, such as pipes, are read
+ * to memory instead. A mapped file is kept open, so that write_rest can
+ * copy from it.
+ * @throws Error if the file cannot be opened or read.
+ */
+MappedFile::MappedFile(std::string const& filename)
+	: data_(0), size_(0), pos_(0), mapped_(false), fd_(-1)
+{
+	int fd = open(filename.c_str(), O_RDONLY);
+	if (fd < 0) throw Error(_("Unable to open file %s"), filename.c_str());
+
+	try {
+		map(fd, false);
+	} catch (Error const& err) {
+		close(fd);
+		throw Error(_("Unable to read file %s"), filename.c_str());
+	}
+	if (mapped_)
+		fd_ = fd;
+	else
+		close(fd);
+}
+
+MappedFile::MappedFile()
+	: data_(0), size_(0), pos_(0), mapped_(false), fd_(-1)
+{
+}
+
+MappedFile::~MappedFile()
+{
+	if (mapped_)
+		munmap(const_cast<char*>(data_), size_);
+	else
+		free(const_cast<char*>(data_));
+	if (fd_ >= 0)
+		close(fd_);
+}
+
+/**
+ * Map an already open file, which is left open. Only regular files are
+ * mapped, so that reading streams such as pipes is left to the caller.
+ * @return The mapping, or 0 if fd is not a regular file.
+ */
+MappedFile* MappedFile::map_fd(int fd)
+{
+	MappedFile* file = new MappedFile();
+	try {
+		if (file->map(fd, true)) return file;
+	} catch (Error const& err) {
+	}
+	delete file;
+	return 0;
+}
+
+/**
+ * Map the file from its current offset to the end. The mapping starts at
+ * offset zero, as mmap requires page alignment, and the read position is
+ * set to the current offset.
+ * @return false if regular_only and fd is not a regular file
+ */
+bool MappedFile::map(int fd, bool regular_only)
+{
+	struct stat st;
+	if (fstat(fd, &st) != 0) throw Error("fstat");
+
+	if (!S_ISREG(st.st_mode)) {
+		if (regular_only) return false;
+		read_all(fd);
+		return true;
+	}
+
+	off_t offset = lseek(fd, 0, SEEK_CUR);
+	if (offset < 0) offset = 0;
+
+	size_ = st.st_size;
+	pos_ = offset < st.st_size ? offset : st.st_size;
+	if (size_ == 0) return true;
+
+	void* p = mmap(0, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (p == MAP_FAILED) {
+		size_ = pos_ = 0;
+		read_all(fd);
+		return true;
+	}
+	madvise(p, size_, MADV_SEQUENTIAL);
+
+	data_ = static_cast<char const*>(p);
+	mapped_ = true;
+	return true;
+}
+
+/**
+ * Read the rest of the file to a buffer.
+ */
+void MappedFile::read_all(int fd)
+{
+	size_t capacity = 65536;
+	char* buf = static_cast<char*>(malloc(capacity));
+	size_t len = 0;
+
+	for (;;) {
+		if (len == capacity) {
+			capacity *= 2;
+			buf = static_cast<char*>(realloc(buf, capacity));
+		}
+		ssize_t n = read(fd, buf + len, capacity - len);
+		if (n == 0) break;
+		if (n < 0) {
+			if (errno == EINTR) continue;
+			free(buf);
+			throw Error("read");
+		}
+		len += n;
+	}
+
+	data_ = buf;
+	size_ = len;
+	pos_ = 0;
+	mapped_ = false;
+}
+
+bool MappedFile::next_line(char const** begin, char const** end)
+{
+	if (pos_ >= size_) return false;
+
+	char const* b = data_ + pos_;
+	char const* e = static_cast<char const*>(
+		memchr(b, '\n', size_ - pos_));
+	if (e == 0) {
+		e = data_ + size_;
+		pos_ = size_;
+	} else {
+		pos_ = e - data_ + 1;
+	}
+
+	*begin = b;
+	*end = e;
+	return true;
+}
+
+void MappedFile::take_rest(char const** begin, char const** end)
+{
+	*begin = data_ + pos_;
+	*end = data_ + size_;
+	pos_ = size_;
+}
+
+/**
+ * Write the unread rest of the file to out. If the file is open, the bytes
+ * are copied by the kernel with copy_file_range or sendfile, without
+ * passing through user space; whatever they could not copy is written from
+ * the mapping.
+ */
+void MappedFile::write_rest(FILE* out)
+{
+	char const* begin;
+	char const* end;
+	take_rest(&begin, &end);
+
+	size_t left = end - begin;
+	if (fd_ >= 0 && left > 0 && fflush(out) == 0) {
+		int out_fd = fileno(out);
+		while (left > 0) {
+			ssize_t n = -1;
+#ifdef HAVE_COPY_FILE_RANGE
+			loff_t in_off = end - left - data_;
+			n = copy_file_range(fd_, &in_off, out_fd, 0, left, 0);
+#endif
+#ifdef HAVE_SENDFILE
+			if (n <= 0) {
+				off_t off = end - left - data_;
+				n = sendfile(out_fd, fd_, &off, left);
+			}
+#endif
+			if (n <= 0) break;
+			left -= n;
+		}
+	}
+	fwrite(end - left, 1, left, out);
+}
@@ -0,0 +1,94 @@
+/* Copyright (C) Pauli Virtanen
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *********************************************************************************/
+
+/**
+ * @file mapped_file.hh
+ *
+ * Reading whole files through a memory mapping.
+ */
+#ifndef MAPPED_FILE_HH_
+#define MAPPED_FILE_HH_
+
+#include <string>
+#include <stddef.h>
+#include <stdio.h>
+
+/**
+ * A whole file mapped to memory for reading, and read line by line in
+ * place. Files that cannot be mapped are read to memory instead.
+ */
+class MappedFile
+{
+public:
+	/// Map the named file
+	MappedFile(std::string const& filename);
+
+	/// Unmap the file
+	~MappedFile();
+
+	/// Map an open file, if it is a regular file. Returns 0 otherwise.
+	static MappedFile* map_fd(int fd);
+
+	/// The contents of the file
+	char const* data() const { return data_; }
+
+	/// The size of the file
+	size_t size() const { return size_; }
+
+	/// The read position
+	size_t position() const { return pos_; }
+
+	/// Get the next line without its line feed, and advance past it
+	bool next_line(char const** begin, char const** end);
+
+	/// Get the unread rest of the file, and advance to its end
+	void take_rest(char const** begin, char const** end);
+
+	/// Write the unread rest of the file to out, and advance to its end
+	void write_rest(FILE* out);
+
+private:
+	/// Create an empty mapping
+	MappedFile();
+
+	/// Map or read the file open as fd
+	bool map(int fd, bool regular_only);
+
+	/// Read the file open as fd to memory
+	void read_all(int fd);
+
+	/// Not copyable
+	MappedFile(MappedFile const&);
+	MappedFile& operator=(MappedFile const&);
+
+	/// The contents of the file
+	char const* data_;
+
+	/// The size of the contents
+	size_t size_;
+
+	/// The read position
+	size_t pos_;
+
+	/// Is data_ a mapping, instead of a buffer from malloc
+	bool mapped_;
+
+	/// The mapped file, if opened by this object, or -1
+	int fd_;
+};
+
+#endif // MAPPED_FILE_HH_
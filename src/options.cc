@@ -61,6 +61,12 @@ Options::FilterType Options::guess_file_filter(string const& filename)
 	static RegExp roff_re("\\.(ms|mm|me|man)$", rf);
 	static RegExp tex_re("\\.(tex)$", rf);
 	static RegExp html_re("\\.(htm|html|sgml)$", rf);
+	static RegExp markdown_re("\\.(md|markdown|mdown|mkd)$", rf);
+	static RegExp csource_re("\\.(c|h|cc|cp|cpp|cxx|c\\+\\+|hh|hpp|hxx|"
+				 "java|cs|go|rs|swift|kt|scala)$", rf);
+	static RegExp jsource_re("\\.(js|mjs|cjs|jsx|ts|tsx)$", rf);
+	static RegExp script_re("\\.(py|sh|bash|zsh|pl|pm|rb|tcl|awk|r|"
+				"cmake|mk|yml|yaml|toml)$", rf);
 	
 	if (roff_re.match(filename)) {
 		return nroff;
@@ -68,6 +74,14 @@ Options::FilterType Options::guess_file_filter(string const& filename)
 		return tex;
 	} else if (html_re.match(filename)) {
 		return sgml;
+	} else if (markdown_re.match(filename)) {
+		return markdown;
+	} else if (csource_re.match(filename)) {
+		return csource;
+	} else if (jsource_re.match(filename)) {
+		return jsource;
+	} else if (script_re.match(filename)) {
+		return script;
 	} else {
 		return plain;
 	}
@@ -83,6 +97,21 @@ _("Usage: %s [options] [file]...\n"
   "Options: [FMNLVlfsaAtnhgbxBCPmSdpwWTv]\n"
   "\n"
   " -F <file>  Use given file as the configuration file.\n"
+  " --startup-profile\n"
+  "            Print the timing of startup phases to standard error.\n"
+  " --statistics\n"
+  "            Print counters and latency histograms of the spell checking\n"
+  "            operations to standard error at exit and on SIGUSR1.\n"
+  " --unique   With -l, list each misspelled word once, in the order of\n"
+  "            first appearance.\n"
+  " --count    Like --unique, but precede each word with the number of\n"
+  "            its occurrences.\n"
+  " --batch    Check the given files without interaction, and list the\n"
+  "            misspelled words as file:line:column: word.\n"
+  " --jobs=<n> Check the files of --batch, or the distinct words of\n"
+  "            --unique and --count, in n threads.\n"
+  " --json     With -l, -a or --batch, write each misspelled word as a\n"
+  "            JSON object on a line of its own.\n"
   "\n"
   "The following flags are same for ispell:\n"
   " -v[v]      Print version number and exit.\n"
@@ -94,7 +123,9 @@ _("Usage: %s [options] [file]...\n"
   " -l         Only output a list of misspelled words.\n"
   " -f <file>  Specify the output file.\n"
   " -s         Issue SIGTSTP at every end of line.\n"
-  " -a         Read commands.\n"
+  " -a         Read commands. The commands =L<id> <text>,\n"
+  "            =E<id> <start> <end> <text> and =D<id> check a line\n"
+  "            incrementally, reporting only the changes.\n"
   " -A         Read commands and enable a command to include a file.\n"
   " -e[e1234]  Expand affixes.\n"
   " -c         Compress affixes.\n"
@@ -113,7 +144,10 @@ _("Usage: %s [options] [file]...\n"
   " -p <file>  Specify an alternate personal dictionary.\n"
   " -w <chars> Specify additional characters that can be part of a word.\n"
   " -W <len>   Consider words shorter than this always correct.\n"
-  " -T <fmt>   Assume a given formatter type for all files.\n"
+  " -T <fmt>   Assume a given formatter type for all files: plain, tex,\n"
+  "            nroff, sgml, markdown, csource (comments and strings of\n"
+  "            C-like code), jsource (the same for JavaScript) or script\n"
+  "            (the same for # comment code).\n"
   " -r <cset>  Specify the character set of the input.\n"),
   PACKAGE) << std::endl;
 }
@@ -275,6 +309,12 @@ Options::Options(int argc, char* const* argv)
 	  output_file_(), // Output to stdout
 	  config_file_(CONFIG_FILE), // Default configuration file
 	  user_encoding_(),
+	  startup_profile_(false), // No startup timing report
+	  statistics_(false), // No latency statistics
+	  unique_words_(false), // List every misspelled occurrence
+	  word_counts_(false), // No occurrence counts
+	  jobs_(1), // Check in one thread
+	  json_(false), // Ispell-like output
 	  ispell_args_()
 {
 	FilterType next_filter = plain;
@@ -292,6 +332,40 @@ Options::Options(int argc, char* const* argv)
 			config_file_ = arg;
 			continue; // This argument will not be passed to ispell
 
+		} else if (p.is_option("--startup-profile")) {
+			startup_profile_ = true;
+			continue; // This argument will not be passed to ispell
+
+		} else if (p.is_option("--statistics")) {
+			statistics_ = true;
+			continue; // This argument will not be passed to ispell
+
+		} else if (p.is_option("--unique")) {
+			unique_words_ = true;
+			continue; // This argument will not be passed to ispell
+
+		} else if (p.is_option("--count")) {
+			unique_words_ = true;
+			word_counts_ = true;
+			continue; // This argument will not be passed to ispell
+
+		} else if (p.is_option("--batch")) {
+			mode_ = batch;
+			continue; // This argument will not be passed to ispell
+
+		} else if (p.is_option("--json")) {
+			json_ = true;
+			continue; // This argument will not be passed to ispell
+
+		} else if (p.is_option("--jobs", &arg)) {
+			if (*arg == '=') ++arg;
+			istringstream str(arg);
+			str >> jobs_;
+			if (!str || jobs_ < 1) {
+				throw Error(_("Invalid number of jobs %s"), arg);
+			}
+			continue; // This argument will not be passed to ispell
+
 		} else if (p.is_option("-v") ||
 		           p.is_option("-vv") ||
 			   p.is_option("--version")) { // Print version
@@ -409,6 +483,19 @@ Options::Options(int argc, char* const* argv)
 			else if (strcmp(arg, "sgml") == 0 ||
 				 strcmp(arg, "html") == 0)
 				default_filter = sgml;
+			else if (strcmp(arg, "markdown") == 0 ||
+				 strcmp(arg, "md") == 0)
+				default_filter = markdown;
+			else if (strcmp(arg, "csource") == 0 ||
+				 strcmp(arg, "c") == 0)
+				default_filter = csource;
+			else if (strcmp(arg, "jsource") == 0 ||
+				 strcmp(arg, "js") == 0)
+				default_filter = jsource;
+			else if (strcmp(arg, "script") == 0 ||
+				 strcmp(arg, "python") == 0 ||
+				 strcmp(arg, "sh") == 0)
+				default_filter = script;
 
 			next_filter = default_filter;
 			default_filter_set = true;
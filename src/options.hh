@@ -43,6 +43,7 @@ public:
 		list,   ///< Just output a list of misspelled words.
 		pipe,   ///< Read commands and act according to them.
 		ispell, ///< Launch the original ispell instead.
+		batch,  ///< Check the files without interaction.
 		quit    ///< Just quit.
 	} Mode;
 
@@ -51,7 +52,11 @@ public:
 		plain, ///< Filter like a plain text file
 		tex,   ///< Filter a tex file
 		nroff, ///< Filter a nroff file
-		sgml   ///< Filter a sgml file
+		sgml,  ///< Filter a sgml file
+		markdown, ///< Filter a Markdown file
+		csource,  ///< Filter comments and strings of C-like code
+		jsource,  ///< Filter comments and strings of JavaScript
+		script    ///< Filter comments and strings of # comment code
 	} FilterType;
 	
 public:
@@ -128,6 +133,24 @@ public:
 	/// The user-specified encoding, if any
 	std::string user_encoding_;
 
+	/// Is a report of startup phase timings requested
+	bool startup_profile_;
+
+	/// Are per-operation counters and latency histograms requested
+	bool statistics_;
+
+	/// List each misspelled word only once in list mode
+	bool unique_words_;
+
+	/// List the number of occurrences of each misspelled word
+	bool word_counts_;
+
+	/// The number of threads to check words with
+	int jobs_;
+
+	/// Is the output in JSON Lines instead of the ispell-like format
+	bool json_;
+
 private:
 	/// The command line parameters to pass to ispell
 	std::vector<std::string> ispell_args_;
@@ -30,6 +30,7 @@
 #include "common.hh"
 #include "personal_dictionary.hh"
 #include "charset.hh"
+#include "statistics.hh"
 
 #include "glibmm/ustring.h"
 #include "glibmm/convert.h"
@@ -112,13 +113,12 @@ static CapitalizedWord::Capitalization get_capitalization(
 }
 
 /** Check whether a given word is in the dictionary */
-bool PersonalDictionary::check_word(Glib::ustring const& word) const
+bool PersonalDictionary::check_word(CapitalizedWord const& w) const
 {
-	CapitalizedWord w(word);
 	std::set<CapitalizedWord>::const_iterator p;
 	
 	/** Find the first word that is equal as a string */
-	p = std::lower_bound(words_.begin(), words_.end(), w);
+	p = words_.lower_bound(w);
 	
 	/** Find the first one that has also a matching capitalization */
 	while (p != words_.end() && !(w < *p)) {
@@ -134,6 +134,28 @@ bool PersonalDictionary::check_word(Glib::ustring const& word) const
 	return false;
 }
 
+/**
+ * Check whether a given word is in some of the layers. The layers are
+ * consulted in the order they were added.
+ */
+bool LayeredDictionary::check_word(Glib::ustring const& word) const
+{
+	Statistics::Timer timer(Statistics::user_lookup);
+	std::vector<PersonalDictionary const*>::const_iterator i;
+
+	// Skip empty layers without scanning the word at all
+	for (i = layers_.begin(); i != layers_.end(); ++i) {
+		if (!(*i)->empty()) break;
+	}
+	if (i == layers_.end()) return false;
+
+	CapitalizedWord w(word);
+	for (; i != layers_.end(); ++i) {
+		if ((*i)->check_word(w)) return true;
+	}
+	return false;
+}
+
 /** Creates a new capitalized word object */
 CapitalizedWord::CapitalizedWord(Glib::ustring const& word)
 	: capitalization_(::get_capitalization(word)),
@@ -26,6 +26,7 @@
 
 #include <set>
 #include <string>
+#include <vector>
 
 #include "glibmm/ustring.h"
 
@@ -88,7 +89,14 @@ public:
 		{ words_.insert(CapitalizedWord(word)); changed_ = true; }
 
 	/// Check, if the given word is in this dictionary
-	bool check_word(Glib::ustring const& word) const;
+	bool check_word(Glib::ustring const& word) const
+		{ return check_word(CapitalizedWord(word)); }
+
+	/// Check, if the given already scanned word is in this dictionary
+	bool check_word(CapitalizedWord const& word) const;
+
+	/// Return true if there are no words in this dictionary
+	bool empty() const { return words_.empty(); }
 
 	/// Remove a word from this dictionary
 	void remove_word(Glib::ustring const& word)
@@ -105,4 +113,24 @@ private:
 	bool changed_;
 };
 
+/**
+ * Several dictionaries consulted as one. A word is accepted if any of
+ * the layers accepts it. The capitalization of the word is scanned only
+ * once, and not at all if every layer is empty.
+ */
+class LayeredDictionary
+{
+public:
+	/// Add a dictionary to be consulted after the already added ones
+	void add_layer(PersonalDictionary const* layer)
+		{ layers_.push_back(layer); }
+
+	/// Check, if the given word is in some of the layers
+	bool check_word(Glib::ustring const& word) const;
+
+private:
+	/// The layers in the order they are consulted
+	std::vector<PersonalDictionary const*> layers_;
+};
+
 #endif // PERSONAL_DICTIONARY_HH_
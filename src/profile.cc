@@ -0,0 +1,162 @@
+/* Copyright (C) Pauli Virtanen
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *********************************************************************************/
+
+/**
+ * @file profile.cc
+ *
+ * Timing the phases of program startup.
+ *
+ * The report is line oriented, one "key=value" record per line:
+ *
+ *   startup-profile version=1 clock=monotonic
+ *   startup-profile phase=config start_us=120 end_us=310 duration_us=190 maxrss_kb=2804
+ *   startup-profile ready_us=4980 total_us=5123 maxrss_kb=6012
+ *
+ * Here ready_us is the moment the interface was ready to check words, and
+ * total_us the moment the last phase ended. Phases running in the
+ * background may end after the interface is ready.
+ */
+#include <stdio.h>
+#include <time.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+
+#include "profile.hh"
+
+/** Return the current monotonic time in microseconds */
+static long long monotonic_us()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (long long)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+/** Return the peak resident set size of this process in KiB */
+static long peak_rss_kb()
+{
+	struct rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage) != 0) return -1;
+	return usage.ru_maxrss;
+}
+
+/** The profile of this process */
+StartupProfile* StartupProfile::profile_ = 0;
+
+/**
+ * Get the startup profile of this process, starting the clock on first
+ * call.
+ */
+StartupProfile& StartupProfile::get()
+{
+	if (profile_ == 0) {
+		// XXX: Never deleted, just one object per application.
+		profile_ = new StartupProfile();
+	}
+	return *profile_;
+}
+
+StartupProfile::StartupProfile()
+	: records_(), origin_(monotonic_us()), ready_(0), enabled_(false),
+	  finished_(false), reported_(false)
+{
+	pthread_mutex_init(&lock_, 0);
+}
+
+/**
+ * Locks a mutex for the lifetime of this object.
+ */
+class ProfileLock
+{
+public:
+	ProfileLock(pthread_mutex_t* lock) : lock_(lock)
+		{ pthread_mutex_lock(lock_); }
+	~ProfileLock() { pthread_mutex_unlock(lock_); }
+private:
+	pthread_mutex_t* lock_;
+};
+
+void StartupProfile::begin(char const* phase)
+{
+	ProfileLock lock(&lock_);
+	if (finished_) return;
+
+	Record r;
+	r.name = phase;
+	r.start = monotonic_us() - origin_;
+	r.end = -1;
+	r.maxrss = -1;
+	records_.push_back(r);
+}
+
+void StartupProfile::end(char const* phase)
+{
+	ProfileLock lock(&lock_);
+	if (reported_) return;
+
+	std::vector<Record>::reverse_iterator i;
+	for (i = records_.rbegin(); i != records_.rend(); ++i) {
+		if (i->end < 0 && i->name == phase) {
+			i->end = monotonic_us() - origin_;
+			i->maxrss = peak_rss_kb();
+			break;
+		}
+	}
+
+	if (finished_) report();
+}
+
+/**
+ * Mark the startup finished. No new phases are recorded after this.
+ */
+void StartupProfile::finish()
+{
+	ProfileLock lock(&lock_);
+	if (finished_) return;
+
+	finished_ = true;
+	ready_ = monotonic_us() - origin_;
+	report();
+}
+
+/**
+ * Print the phases to stderr, if requested and no phase is running.
+ * Must be called with the lock held.
+ */
+void StartupProfile::report()
+{
+	if (!enabled_ || reported_) return;
+
+	std::vector<Record>::const_iterator i;
+	for (i = records_.begin(); i != records_.end(); ++i) {
+		if (i->end < 0) return;
+	}
+	reported_ = true;
+
+	fprintf(stderr, "startup-profile version=1 clock=monotonic\n");
+
+	for (i = records_.begin(); i != records_.end(); ++i) {
+		fprintf(stderr, "startup-profile phase=%s start_us=%lld "
+			"end_us=%lld duration_us=%lld maxrss_kb=%ld\n",
+			i->name, i->start, i->end, i->end - i->start,
+			i->maxrss);
+	}
+
+	fprintf(stderr, "startup-profile ready_us=%lld total_us=%lld "
+		"maxrss_kb=%ld\n",
+		ready_, monotonic_us() - origin_, peak_rss_kb());
+	fflush(stderr);
+}
@@ -0,0 +1,111 @@
+/* Copyright (C) Pauli Virtanen
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *********************************************************************************/
+
+/**
+ * @file profile.hh
+ *
+ * Timing the phases of program startup.
+ */
+#ifndef PROFILE_HH_
+#define PROFILE_HH_
+
+#include <vector>
+#include <pthread.h>
+
+/**
+ * Monotonic timestamps and peak memory use for each startup phase.
+ * Phases are recorded always, since the options enabling the report are
+ * parsed only after the first phases. The report is printed to stderr.
+ * Phases may be recorded from several threads.
+ */
+class StartupProfile
+{
+public:
+	/// Return the startup profile of this process
+	static StartupProfile& get();
+
+	/// Request the report to be printed when startup is finished
+	void enable() { enabled_ = true; }
+
+	/// Start timing a phase
+	void begin(char const* phase);
+
+	/// End timing the most recently started phase with the given name
+	void end(char const* phase);
+
+	/// End startup. The report is printed, if requested, as soon as the
+	/// phases still running have ended too.
+	void finish();
+
+	/// Has the startup finished
+	bool finished() const { return finished_; }
+
+	/**
+	 * A phase lasting for the lifetime of this object.
+	 */
+	class Phase
+	{
+	public:
+		Phase(char const* name) : name_(name)
+			{ StartupProfile::get().begin(name_); }
+		~Phase() { StartupProfile::get().end(name_); }
+	private:
+		char const* name_;
+	};
+
+private:
+	/// Start a profile at the current moment
+	StartupProfile();
+
+	/// Timing information of a single phase
+	struct Record
+	{
+		char const* name;  ///< Name of the phase
+		long long start;   ///< Start time, in microseconds
+		long long end;     ///< End time, in microseconds, or -1
+		long maxrss;       ///< Peak resident set size at end, in KiB
+	};
+
+	/// The recorded phases in the order they were started
+	std::vector<Record> records_;
+
+	/// Print the report, if requested and everything has ended
+	void report();
+
+	/// The moment the profile was started, in microseconds
+	long long origin_;
+
+	/// The moment the startup finished, in microseconds
+	long long ready_;
+
+	/// Is the report wanted
+	bool enabled_;
+
+	/// Is the startup finished
+	bool finished_;
+
+	/// Has the report been printed
+	bool reported_;
+
+	/// Lock protecting the records
+	pthread_mutex_t lock_;
+
+	/// The profile of this process
+	static StartupProfile* profile_;
+};
+
+#endif // PROFILE_HH_
@@ -16,9 +16,13 @@
  *********************************************************************************/
 
 #include <stdlib.h>
+#include <ctype.h>
 #include <regex.h>
 
+#include <algorithm>
+#include <bitset>
 #include <string>
+#include <vector>
 
 #include "regexp.hh"
 #include "tmerror.hh"
@@ -32,9 +36,410 @@ static Error get_regerror(int errcode, regex_t const* compiled)
 	return Error(buffer);
 }
 
+
+/****************************************************************************/
+/** @name Anchored pattern automaton
+ ** @{
+ **/
+
+/**
+ * A compiled anchored pattern, run as a Thompson NFA that keeps the
+ * submatch positions of each thread (a Pike VM). All live threads advance
+ * over a byte together, so the cost is proportional to the length of the
+ * longest possible match times the size of the pattern, and no byte past
+ * the point where all threads have died is read.
+ *
+ * As in POSIX, the longest match wins; of the threads reaching it, the one
+ * preferring longer earlier repetitions gives the subexpressions.
+ */
+class RegExp::Automaton
+{
+public:
+	/// Compile a pattern, or return 0 if it is not of the supported kind
+	static Automaton* compile(const char* pattern, Flag flags,
+				  unsigned int subexpressions);
+
+	/// Match at begin; store the positions in matches on success
+	bool run(const char* begin, const char* end, regmatch_t* matches);
+
+private:
+	/// A set of bytes
+	typedef std::bitset<256> ByteSet;
+
+	/// Kinds of instructions
+	enum Op {
+		BYTE,	///< Consume a byte in sets_[arg_]
+		SPLIT,	///< Continue at x_, or with lower priority at y_
+		JUMP,	///< Continue at x_
+		SAVE,	///< Store the position to slot arg_
+		EOL,	///< Continue only at the end of the string
+		MATCH	///< The pattern has matched
+	};
+
+	/// An instruction of the program
+	struct Instruction
+	{
+		Instruction(Op op, int arg = 0, int x = 0, int y = 0)
+			: op_(op), arg_(arg), x_(x), y_(y) {}
+		Op op_;
+		int arg_;
+		int x_;
+		int y_;
+	};
+
+	/// A list of threads: program counters and their slots
+	struct ThreadList
+	{
+		ThreadList() : size_(0) {}
+		std::vector<int> pcs_;
+		std::vector<int> slots_;
+		unsigned int size_;
+	};
+
+	Automaton(unsigned int slots) : slots_(slots), generation_(0) {}
+
+	/// Build the program after the ^; return false if unsupported
+	bool parse(const char* pattern, Flag flags,
+		   unsigned int subexpressions);
+
+	/// Parse a bracket expression after its [; return false if unsupported
+	static bool parse_bracket(const char*& p, ByteSet* set);
+
+	/// Add a thread at pc and all threads reachable from it without input
+	void add_thread(ThreadList& list, int pc, int* slots, int pos, int len);
+
+	/// The program
+	std::vector<Instruction> code_;
+
+	/// The byte sets used by the program
+	std::vector<ByteSet> sets_;
+
+	/// The number of position slots: two for each subexpression
+	unsigned int slots_;
+
+	/// The threads at the current and at the next position
+	ThreadList lists_[2];
+
+	/// The slots of the best match so far, and the slots being built
+	std::vector<int> best_, work_;
+
+	/// The generation in which each instruction was last added
+	std::vector<unsigned int> added_;
+
+	/// The current generation
+	unsigned int generation_;
+};
+
+/**
+ * Parse the body of a bracket expression, leaving p after the closing ].
+ * Only ASCII members, ranges of them and character classes are supported.
+ */
+bool RegExp::Automaton::parse_bracket(const char*& p, ByteSet* set)
+{
+	bool first = true;
+	while (*p != '\0' && (*p != ']' || first)) {
+		first = false;
+		unsigned char c = *p;
+		if (c >= 0x80) return false;
+
+		if (c == '[' && (p[1] == '.' || p[1] == '=')) {
+			return false;
+		} else if (c == '[' && p[1] == ':') {
+			const char* name = p + 2;
+			const char* name_end = strchr(name, ':');
+			if (!name_end || name_end[1] != ']') return false;
+			std::string cls(name, name_end);
+			int (*test)(int);
+			if (cls == "alpha") test = isalpha;
+			else if (cls == "digit") test = isdigit;
+			else if (cls == "alnum") test = isalnum;
+			else if (cls == "space") test = isspace;
+			else if (cls == "upper") test = isupper;
+			else if (cls == "lower") test = islower;
+			else if (cls == "punct") test = ispunct;
+			else if (cls == "xdigit") test = isxdigit;
+			else if (cls == "cntrl") test = iscntrl;
+			else if (cls == "print") test = isprint;
+			else if (cls == "graph") test = isgraph;
+			else return false;
+			for (int b = 0; b < 0x80; ++b)
+				if (test(b)) set->set(b);
+			p = name_end + 2;
+		} else if (p[1] == '-' && p[2] != ']' && p[2] != '\0') {
+			unsigned char last = p[2];
+			if (last >= 0x80 || last < c || last == '[') return false;
+			for (int b = c; b <= last; ++b) set->set(b);
+			p += 3;
+		} else {
+			set->set(c);
+			++p;
+		}
+	}
+	if (*p != ']') return false;
+	++p;
+	return true;
+}
+
+/**
+ * Compile an extended pattern starting with ^ to a program, deleting the
+ * automaton again if parse() rejects the pattern.
+ */
+RegExp::Automaton* RegExp::Automaton::compile(const char* pattern, Flag flags,
+					      unsigned int subexpressions)
+{
+	if (!(flags & EXTENDED) || pattern[0] != '^') return 0;
+
+	Automaton* a = new Automaton(2 * (subexpressions + 1));
+	try {
+		if (a->parse(pattern + 1, flags, subexpressions)) return a;
+	} catch (...) {
+		delete a;
+		throw;
+	}
+	delete a;
+	return 0;
+}
+
+/**
+ * Build the program of a pattern from after its ^. Patterns with
+ * alternation, intervals, back references or operators applied to groups
+ * are not supported. Neither are ones where a non-ASCII character could be
+ * matched by a single-byte step; an atom able to match such bytes must be
+ * repeated with * or +, so that it consumes whole characters.
+ */
+bool RegExp::Automaton::parse(const char* pattern, Flag flags,
+			       unsigned int subexpressions)
+{
+	std::vector<Instruction>& code = code_;
+	std::vector<int> groups;
+	unsigned int group_count = 0;
+
+	code.push_back(Instruction(SAVE, 0));
+	const char* p = pattern;
+	while (*p != '\0') {
+		ByteSet set;
+		bool literal = false;
+		unsigned char c = *p;
+
+		if (c == '(') {
+			if (p[1] == '?') return false;
+			groups.push_back(++group_count);
+			code.push_back(Instruction(SAVE, 2 * group_count));
+			++p;
+			continue;
+		} else if (c == ')') {
+			if (groups.empty()) return false;
+			code.push_back(Instruction(SAVE, 2 * groups.back() + 1));
+			groups.pop_back();
+			++p;
+			if (*p == '*' || *p == '+' || *p == '?' || *p == '{')
+				return false;
+			continue;
+		} else if (c == '$') {
+			if (p[1] != '\0') return false;
+			code.push_back(Instruction(EOL));
+			++p;
+			continue;
+		} else if (c == '[') {
+			++p;
+			bool negate = (*p == '^');
+			if (negate) ++p;
+			if (!parse_bracket(p, &set)) return false;
+			if (flags & ICASE) {
+				for (int b = 'a'; b <= 'z'; ++b) {
+					if (set[b] || set[toupper(b)]) {
+						set.set(b);
+						set.set(toupper(b));
+					}
+				}
+			}
+			if (negate) {
+				set.flip();
+				set.reset(0);
+				if (flags & NEWLINE) set.reset('\n');
+			}
+		} else if (c == '.') {
+			set.set();
+			set.reset(0);
+			if (flags & NEWLINE) set.reset('\n');
+			++p;
+		} else if (c == '\\') {
+			unsigned char e = p[1];
+			if (e == '\0' || isalnum(e) || e >= 0x80) return false;
+			set.set(e);
+			p += 2;
+		} else if (c == '|' || c == '^' || c == '{' || c == '*' ||
+			   c == '+' || c == '?') {
+			return false;
+		} else {
+			if (c >= 0x80 && (flags & ICASE)) return false;
+			set.set(c);
+			if ((flags & ICASE) && isalpha(c)) {
+				set.set(tolower(c));
+				set.set(toupper(c));
+			}
+			literal = (c >= 0x80);
+			++p;
+		}
+
+		char op = *p;
+		if (op == '*' || op == '+' || op == '?') {
+			++p;
+			if (*p == '*' || *p == '+' || *p == '?' || *p == '{')
+				return false;
+		} else if (op == '{') {
+			return false;
+		} else {
+			op = 0;
+		}
+
+		bool wide = false;
+		for (int b = 0x80; b < 0x100 && !wide; ++b) wide = set[b];
+		if (wide && !literal && op != '*' && op != '+') return false;
+		if (literal && op != 0) return false;
+
+		int s = sets_.size();
+		sets_.push_back(set);
+		int pc = code.size();
+		switch (op) {
+		case '?':
+			code.push_back(Instruction(SPLIT, 0, pc + 1, pc + 2));
+			code.push_back(Instruction(BYTE, s));
+			break;
+		case '*':
+			code.push_back(Instruction(SPLIT, 0, pc + 1, pc + 3));
+			code.push_back(Instruction(BYTE, s));
+			code.push_back(Instruction(JUMP, 0, pc));
+			break;
+		case '+':
+			code.push_back(Instruction(BYTE, s));
+			code.push_back(Instruction(SPLIT, 0, pc, pc + 2));
+			break;
+		default:
+			code.push_back(Instruction(BYTE, s));
+			break;
+		}
+	}
+	if (!groups.empty() || group_count != subexpressions) return false;
+
+	code.push_back(Instruction(SAVE, 1));
+	code.push_back(Instruction(MATCH));
+
+	added_.resize(code.size(), 0);
+	for (int i = 0; i < 2; ++i) {
+		lists_[i].pcs_.resize(code.size());
+		lists_[i].slots_.resize(code.size() * slots_);
+	}
+	best_.resize(slots_);
+	work_.resize(slots_);
+	return true;
+}
+
+/**
+ * Follow the instructions not consuming input from pc, with the positions
+ * in slots, and add the threads stopping at BYTE or MATCH to the list in
+ * order of priority.
+ */
+void RegExp::Automaton::add_thread(ThreadList& list, int pc, int* slots,
+				   int pos, int len)
+{
+	if (added_[pc] == generation_) return;
+	added_[pc] = generation_;
+
+	Instruction const& in = code_[pc];
+	switch (in.op_) {
+	case JUMP:
+		add_thread(list, in.x_, slots, pos, len);
+		break;
+	case SPLIT:
+		add_thread(list, in.x_, slots, pos, len);
+		add_thread(list, in.y_, slots, pos, len);
+		break;
+	case SAVE:
+	{
+		int old = slots[in.arg_];
+		slots[in.arg_] = pos;
+		add_thread(list, pc + 1, slots, pos, len);
+		slots[in.arg_] = old;
+		break;
+	}
+	case EOL:
+		if (pos == len) add_thread(list, pc + 1, slots, pos, len);
+		break;
+	default:
+		list.pcs_[list.size_] = pc;
+		std::copy(slots, slots + slots_,
+			  list.slots_.begin() + list.size_ * slots_);
+		++list.size_;
+		break;
+	}
+}
+
+/**
+ * Run the program from begin, reading no further than end.
+ */
+bool RegExp::Automaton::run(const char* begin, const char* end,
+			    regmatch_t* matches)
+{
+	int len = end - begin;
+	bool matched = false;
+	int matched_at = -1;
+
+	ThreadList* current = &lists_[0];
+	ThreadList* next = &lists_[1];
+
+	std::fill(work_.begin(), work_.end(), -1);
+	current->size_ = 0;
+	++generation_;
+	add_thread(*current, 0, &work_[0], 0, len);
+
+	for (int pos = 0; current->size_ > 0; ++pos) {
+		next->size_ = 0;
+		++generation_;
+		unsigned char c = (pos < len) ? begin[pos] : 0;
+
+		for (unsigned int t = 0; t < current->size_; ++t) {
+			Instruction const& in = code_[current->pcs_[t]];
+			int* slots = &current->slots_[t * slots_];
+			if (in.op_ == MATCH) {
+				if (matched_at < pos) {
+					std::copy(slots, slots + slots_,
+						  best_.begin());
+					matched = true;
+					matched_at = pos;
+				}
+			} else if (pos < len && sets_[in.arg_][c]) {
+				std::copy(slots, slots + slots_,
+					  work_.begin());
+				add_thread(*next, current->pcs_[t] + 1,
+					   &work_[0], pos + 1, len);
+			}
+		}
+		if (pos >= len) break;
+		std::swap(current, next);
+	}
+
+	if (!matched) return false;
+	for (unsigned int n = 0; n < slots_ / 2; ++n) {
+		matches[n].rm_so = best_[2 * n];
+		matches[n].rm_eo = best_[2 * n + 1];
+		if (matches[n].rm_so < 0 || matches[n].rm_eo < 0)
+			matches[n].rm_so = matches[n].rm_eo = -1;
+	}
+	return true;
+}
+
+/** @} */
+
+
+/****************************************************************************/
+/** @name Regular expressions
+ ** @{
+ **/
+
 /** Compiles the given pattern to a regular expression */
 RegExp::RegExp(const char* regstr, Flag flags)
-	: matches_(0), offset_(0)
+	: automaton_(0), matches_(0), offset_(0)
 {
 	int regex_flags =
 		((flags & EXTENDED) ? REG_EXTENDED : 0) | 
@@ -49,20 +454,36 @@ RegExp::RegExp(const char* regstr, Flag flags)
 	}
 
 	matches_ = new regmatch_t[regexp_.re_nsub + 1];
+	automaton_ = Automaton::compile(regstr, flags, regexp_.re_nsub);
 }
 
 /** Destroys this regular expression */
 RegExp::~RegExp()
 {
 	regfree(&regexp_);
+	delete automaton_;
 	delete [] matches_;
 	matches_ = 0;
 }
 
-/** Attempts to match this regular expression to a string */
-bool RegExp::do_match(const char* str)
+/**
+ * Attempts to match this regular expression to the bytes from begin to
+ * end. Where regexec cannot be given the end, the bytes are copied.
+ */
+bool RegExp::do_match(const char* begin, const char* end)
 {
-	int code = regexec(&regexp_, str, regexp_.re_nsub + 1, matches_, 0);
+	if (automaton_) return automaton_->run(begin, end, matches_);
+
+#ifdef REG_STARTEND
+	matches_[0].rm_so = 0;
+	matches_[0].rm_eo = end - begin;
+	int code = regexec(&regexp_, begin, regexp_.re_nsub + 1, matches_,
+			   REG_STARTEND);
+#else
+	std::string str(begin, end);
+	int code = regexec(&regexp_, str.c_str(), regexp_.re_nsub + 1,
+			   matches_, 0);
+#endif
 
 	if (code == 0)
 		return true;
@@ -98,3 +519,5 @@ unsigned int RegExp::end(unsigned int n) const
 		return 0;
 	}
 }
+
+/** @} */
@@ -28,9 +28,17 @@
 #include "common.hh"
 #include <string>
 #include <regex.h>
+#include <string.h>
 
 /**
  * A POSIX regular expression.
+ *
+ * Extended patterns anchored with ^ and made of literals, bracket
+ * expressions, groups and the *, + and ? operators are also compiled
+ * to a small automaton. It matches bytewise and reads the string only
+ * as far as the match can reach, so that matching at the start of a
+ * long buffer is cheap. Its bracket classes are those of the C locale.
+ * Other patterns are left to regexec.
  */
 class RegExp
 {
@@ -59,28 +67,40 @@ public:
 	
 	/// Matches a regular expression to a string
 	bool match(const char* str)
-		{ offset_ = 0; return do_match(str); }
+		{ offset_ = 0; return do_match(str, str + strlen(str)); }
+
+	/// Matches a regular expression to the bytes from begin to end
+	bool match(const char* begin, const char* end)
+		{ offset_ = 0; return do_match(begin, end); }
 
 	/// Matches a regular expression to a std::string
 	bool match(std::string const& str)
-		{ offset_ = 0; return do_match(str.c_str()); }
+		{
+			offset_ = 0;
+			return do_match(str.data(), str.data() + str.size());
+		}
 
 	/// Matches a regular expression to a std::string, with offset
 	bool match(std::string const& str, std::string::const_iterator p)
 		{
 			offset_ = p - str.begin();
-			return do_match(str.c_str() + offset_);
+			return do_match(str.data() + offset_,
+					str.data() + str.size());
 		}
 	
 	/// Matches a regular expression to a Glib::ustring
 	bool match(Glib::ustring const& str)
-		{ offset_ = 0; return do_match(str.c_str()); }
+		{
+			offset_ = 0;
+			return do_match(str.data(), str.data() + str.bytes());
+		}
 
 	/// Matches a regular expression to a Glib::ustring, with offset
 	bool match(Glib::ustring const& str, Glib::ustring::const_iterator p)
 		{
 			offset_ = p.base() - str.begin().base();
-			return do_match(str.c_str() + offset_);
+			return do_match(str.data() + offset_,
+					str.data() + str.bytes());
 		}
 	
 	/// The begin of #nth subexpression in last matched string (0=regexp)
@@ -105,11 +125,16 @@ public:
 		}
 
 private:
-	bool do_match(const char* str);
+	class Automaton;
+
+	bool do_match(const char* begin, const char* end);
 	
 	/// The compiled POSIX regexp
 	regex_t regexp_;
 
+	/// The compiled automaton for an anchored pattern, or 0
+	Automaton* automaton_;
+
 	/// Information about last matched subexpressions
 	regmatch_t* matches_;
 
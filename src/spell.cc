@@ -34,6 +34,8 @@
 #include "common.hh"
 #include "i18n.hh"
 #include "spell.hh"
+#include "profile.hh"
+#include "statistics.hh"
 
 using std::string;
 using std::ostringstream;
@@ -43,14 +45,38 @@ using std::vector;
 /**
  * Opens the given spell check library and loads the given dictionary.
  * Encoding is set to latin9 by default.
+ *
+ * Initializing libvoikko is the slowest part of startup, so it is done
+ * in a background thread. The methods using the library wait for it to
+ * finish.
  */
 Spellchecker::Spellchecker(std::string const& library,
 			   std::string const& dictionary,
 			   std::string const& encoding)
-	: voikkohandle(0), initialized_(false)
+	: voikkohandle(0), init_running_(false), initialized_(false),
+	  dictionary_file_(dictionary), encoding_(encoding)
+{
+	conv_ = new CharsetConverter("UTF-8");
+
+	// The phase is started here, so that it is known to be running
+	// even if the thread has not been scheduled yet.
+	StartupProfile::get().begin("voikko_init");
+
+	if (pthread_create(&init_thread_, 0, initialize_thread, this) == 0) {
+		init_running_ = true;
+	} else {
+		// No threads: initialize right away instead. A failure is
+		// still reported by wait_ready().
+		initialize();
+	}
+}
+
+/**
+ * Initialize libvoikko. Failures are reported by wait_ready().
+ */
+void Spellchecker::initialize()
 {
 	try {
-		
 		const char* error = voikko_init(&voikkohandle, "fi_FI", 0);
 		if (error != 0) 
 			throw Error(_("Error initialising libvoikko"));
@@ -58,14 +84,39 @@ Spellchecker::Spellchecker(std::string const& library,
 		voikko_set_bool_option(voikkohandle, VOIKKO_OPT_IGNORE_NUMBERS, 1);
 		voikko_set_bool_option(voikkohandle, VOIKKO_OPT_IGNORE_UPPERCASE, 1);
 		initialized_ = true;
-		open_dictionary(dictionary);
-		set_encoding(encoding);
+		open_dictionary(dictionary_file_);
+		set_encoding(encoding_);
 	} catch (Error const& err) {
+		// The handle is open, if only the dictionary or the encoding
+		// failed
+		if (initialized_)
+			voikko_terminate(voikkohandle);
 		initialized_ = false;
-		throw Error(_("Error initialising libvoikko"));
 	}
 
-	conv_ = new CharsetConverter("UTF-8");
+	StartupProfile::get().end("voikko_init");
+}
+
+void* Spellchecker::initialize_thread(void* self)
+{
+	static_cast<Spellchecker*>(self)->initialize();
+	return 0;
+}
+
+/**
+ * Wait for the background initialization to finish.
+ * @throws Error If libvoikko could not be initialized.
+ */
+void Spellchecker::wait_ready()
+{
+	if (init_running_) {
+		StartupProfile::Phase phase("voikko_wait");
+		pthread_join(init_thread_, 0);
+		init_running_ = false;
+	}
+
+	if (!initialized_)
+		throw Error(_("Error initialising libvoikko"));
 }
 
 /**
@@ -73,7 +124,12 @@ Spellchecker::Spellchecker(std::string const& library,
  */
 Spellchecker::~Spellchecker()
 {
-	voikko_terminate(voikkohandle);
+	if (init_running_) {
+		pthread_join(init_thread_, 0);
+		init_running_ = false;
+	}
+	if (initialized_)
+		voikko_terminate(voikkohandle);
 	delete conv_;
 	initialized_ = false;
 }
@@ -117,10 +173,15 @@ bool Spellchecker::check_word(Glib::ustring const& word)
 {
 	int status;
 
+	if (init_running_) wait_ready();
+
 	std::string lword = conv_->to(word);
 
 
-	status = voikko_spell_cstr(voikkohandle, lword.c_str());
+	{
+		Statistics::Timer timer(Statistics::voikko_spell);
+		status = voikko_spell_cstr(voikkohandle, lword.c_str());
+	}
 	if (status) return true;
 	else return false;
 }
@@ -136,8 +197,13 @@ void Spellchecker::get_suggestions(Glib::ustring const& word,
 	char ** vsuggestions;
 	int word_count;
 
+	if (init_running_) wait_ready();
+
 	std::string lword = conv_->to(word);
-	vsuggestions = voikko_suggest_cstr(voikkohandle, lword.c_str());
+	{
+		Statistics::Timer timer(Statistics::voikko_suggest);
+		vsuggestions = voikko_suggest_cstr(voikkohandle, lword.c_str());
+	}
 	
 	word_count = 0;
 	if (vsuggestions != 0) while (vsuggestions[word_count] != 0) word_count++;
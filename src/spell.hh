@@ -27,6 +27,7 @@
 
 #include <string>
 #include <vector>
+#include <pthread.h>
 #include <libvoikko/voikko.h>
 
 #include "glibmm/ustring.h"
@@ -41,7 +42,8 @@
 class Spellchecker
 {
 public:
-	/// Load the given dynamic library and use the given dictionary
+	/// Load the given dynamic library and use the given dictionary.
+	/// The library is initialized in the background.
 	Spellchecker(std::string const& library,
 		     std::string const& dictionary,
 		     std::string const& encoding="latin9");
@@ -49,6 +51,9 @@ public:
 	/// Deinitialize the spell checker
 	~Spellchecker();
 
+	/// Wait until the library is initialized
+	void wait_ready();
+
 	/// Return the version of the library
 	int get_version();
 	
@@ -72,10 +77,23 @@ public:
 			     std::vector<Glib::ustring>& suggestions)
 		{ get_suggestions(Glib::ustring(begin, end), suggestions); }
 
+private:
+	/// Initialize the library
+	void initialize();
+
+	/// Thread entry point running initialize()
+	static void* initialize_thread(void* self);
+
 private:
 
 	int			voikkohandle;
 
+	/// The thread initializing the library
+	pthread_t		init_thread_;
+
+	/// Is the initializing thread still to be joined
+	bool			init_running_;
+
 	/// Is the loaded library properly initialized
 	bool			initialized_;
 
@@ -0,0 +1,133 @@
+/* Copyright (C) Pauli Virtanen
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *********************************************************************************/
+
+/**
+ * @file statistics.cc
+ *
+ * Counters and latency histograms for the operations done per word.
+ *
+ * The dump has one line per operation that has been recorded:
+ *
+ *   stats probe=voikko_spell count=812 total_ns=9210344 mean_ns=11342 max_ns=80211 histogram_ns=8192:120,16384:650,32768:40,131072:2
+ *
+ * where each "limit:count" pair of the histogram counts the operations
+ * that took less than limit, but at least half of it, nanoseconds.
+ *
+ * A dump requested with SIGUSR1 is written at the next recorded
+ * operation, since writing from the signal handler is not safe.
+ */
+#include <stdlib.h>
+#include <time.h>
+
+#include "statistics.hh"
+
+/** The names of the operations, as shown in the dump */
+static char const* const probe_names[Statistics::probe_count] = {
+	"filter",
+	"convert_from",
+	"convert_to",
+	"voikko_spell",
+	"voikko_suggest",
+	"user_lookup"
+};
+
+bool Statistics::enabled_ = false;
+volatile sig_atomic_t Statistics::dump_requested_ = 0;
+Statistics::Histogram Statistics::histograms_[Statistics::probe_count];
+
+long long Statistics::now()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+void Statistics::enable()
+{
+	if (enabled_) return;
+	enabled_ = true;
+
+	signal(SIGUSR1, signal_handler);
+	atexit(dump_at_exit);
+}
+
+void Statistics::signal_handler(int sig)
+{
+	sig=sig;
+	dump_requested_ = 1;
+}
+
+void Statistics::dump_at_exit()
+{
+	dump(stderr);
+}
+
+/**
+ * Add an operation to the counters of a probe. Uses atomic additions, so
+ * that the counters stay consistent when several threads record.
+ */
+void Statistics::record(Probe probe, long long ns)
+{
+	if (ns < 0) ns = 0;
+
+	Histogram& h = histograms_[probe];
+
+	int bucket = 0;
+	for (unsigned long long v = ns; v > 1 && bucket < bucket_count - 1;
+	     v >>= 1)
+		++bucket;
+
+	__sync_fetch_and_add(&h.count, 1);
+	__sync_fetch_and_add(&h.total_ns, (unsigned long long)ns);
+	__sync_fetch_and_add(&h.buckets[bucket], 1);
+
+	unsigned long long max = h.max_ns;
+	while ((unsigned long long)ns > max) {
+		unsigned long long old = __sync_val_compare_and_swap(
+			&h.max_ns, max, (unsigned long long)ns);
+		if (old == max) break;
+		max = old;
+	}
+
+	if (dump_requested_) {
+		dump_requested_ = 0;
+		dump(stderr);
+	}
+}
+
+void Statistics::dump(FILE* out)
+{
+	for (int p = 0; p < probe_count; ++p) {
+		Histogram const& h = histograms_[p];
+		if (h.count == 0) continue;
+
+		fprintf(out, "stats probe=%s count=%lu total_ns=%llu "
+			"mean_ns=%llu max_ns=%llu histogram_ns=",
+			probe_names[p], h.count, h.total_ns,
+			h.total_ns / h.count, h.max_ns);
+
+		bool first = true;
+		for (int k = 0; k < bucket_count; ++k) {
+			if (h.buckets[k] == 0) continue;
+			fprintf(out, "%s%llu:%lu", first ? "" : ",",
+				1ULL << (k + 1), h.buckets[k]);
+			first = false;
+		}
+		fprintf(out, "\n");
+	}
+	fflush(out);
+}
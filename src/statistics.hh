@@ -0,0 +1,107 @@
+/* Copyright (C) Pauli Virtanen
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *********************************************************************************/
+
+/**
+ * @file statistics.hh
+ *
+ * Counters and latency histograms for the operations done per word.
+ */
+#ifndef STATISTICS_HH_
+#define STATISTICS_HH_
+
+#include <stdio.h>
+#include <signal.h>
+
+/**
+ * Call counts and log2-bucketed latency histograms of the hot operations.
+ * Always compiled in, but nothing is timed unless enabled at runtime.
+ * Recording is safe from several threads.
+ */
+class Statistics
+{
+public:
+	/// The instrumented operations
+	typedef enum {
+		filter,         ///< Filter::get_next_word
+		convert_from,   ///< CharsetConverter::from
+		convert_to,     ///< CharsetConverter::to
+		voikko_spell,   ///< voikko_spell_cstr
+		voikko_suggest, ///< voikko_suggest_cstr
+		user_lookup,    ///< Personal and session dictionary lookup
+		probe_count     ///< The number of operations
+	} Probe;
+
+	/// Start recording. Dump on exit and on SIGUSR1.
+	static void enable();
+
+	/// Is recording enabled
+	static bool enabled() { return enabled_; }
+
+	/// Record one operation of the given duration
+	static void record(Probe probe, long long ns);
+
+	/// Write the statistics recorded so far
+	static void dump(FILE* out);
+
+	/// Return the current monotonic time in nanoseconds
+	static long long now();
+
+	/**
+	 * Times an operation lasting for the lifetime of this object.
+	 */
+	class Timer
+	{
+	public:
+		Timer(Probe probe)
+			: probe_(probe), start_(enabled_ ? now() : -1) {}
+		~Timer()
+			{ if (start_ >= 0) record(probe_, now() - start_); }
+	private:
+		Probe probe_;
+		long long start_;
+	};
+
+private:
+	/// The number of histogram buckets: bucket k is [2^k, 2^(k+1)) ns
+	enum { bucket_count = 40 };
+
+	/// Counters of one operation
+	struct Histogram
+	{
+		unsigned long count;
+		unsigned long long total_ns;
+		unsigned long long max_ns;
+		unsigned long buckets[bucket_count];
+	};
+
+	/// SIGUSR1 handler: request a dump
+	static void signal_handler(int sig);
+
+	/// Dump to stderr at exit
+	static void dump_at_exit();
+
+	/// Is recording enabled
+	static bool enabled_;
+
+	/// Has a dump been requested by a signal
+	static volatile sig_atomic_t dump_requested_;
+
+	/// The counters for each operation
+	static Histogram histograms_[probe_count];
+};
+
+#endif // STATISTICS_HH_
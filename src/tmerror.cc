@@ -32,6 +32,6 @@ Error::Error(const char* fmt, ...)
 }
 
 Error::Error(std::string const& msg)
-	: std::runtime_error(msg)
+	: std::runtime_error(msg), msg_(msg)
 {
 }
@@ -25,11 +25,16 @@
 #include <string>
 #include <iostream>
 #include <fstream>
+#include <vector>
 
 #include <locale.h>
 
+#include <string.h>
+#include <errno.h>
+#include <stdio.h>
 #include <unistd.h>
 #include <signal.h>
+#include <pthread.h>
 
 #include "config.hh"
 #include "common.hh"
@@ -41,20 +46,28 @@
 #include "personal_dictionary.hh"
 #include "tmispell.hh"
 #include "charset.hh"
+#include "profile.hh"
+#include "statistics.hh"
 
 #include "ui/listui.hh"
 #include "ui/pipeui.hh"
+#include "ui/batchui.hh"
 #include "ui/cursesui.hh"
 
 #include "glibmm/convert.h"
 #include "glibmm/error.h"
 
+#include <glib.h>
+
 /**
  * Initialize and parse the command line parameters to options.
  */
 IspellAlike::IspellAlike(int argc, char* const* argv) 
-	: options_(argc, argv), sp_(0), user_conv_(0), out_(0)
+	: options_(argc, argv), sp_(0), user_conv_(0), out_(0),
+	  exit_status_(0)
 {
+	user_words_.add_layer(&personal_dictionary_);
+	user_words_.add_layer(&session_dictionary_);
 }
 
 /**
@@ -64,6 +77,7 @@ IspellAlike::~IspellAlike()
 {
 	delete out_;
 	delete sp_;
+	delete user_conv_;
 }
 
 /**
@@ -80,11 +94,23 @@ void IspellAlike::start()
 	// Check if the user wants to quit right away
 	if (options_.mode_ == Options::quit) return;
 
+	if (options_.startup_profile_)
+		StartupProfile::get().enable();
+
+	if (options_.statistics_)
+		Statistics::enable();
+
 	// Load configuration file
-	ConfigFile conffile(options_.config_file_);
+	ScopedPtr<ConfigFile> config;
+	{
+		StartupProfile::Phase phase("config");
+		config.reset(new ConfigFile(options_.config_file_));
+	}
+	ConfigFile const& conffile = *config;
 
 	// Check that ispell was given
-	std::string ispell = conffile.get_option("ispell");
+	ispell_ = conffile.get_option("ispell");
+	std::string const& ispell = ispell_;
 	if (ispell.empty()) {
 		throw Error(_("An Ispell program was not given in "
 			      "the configuration file %s"),
@@ -116,17 +142,14 @@ void IspellAlike::start()
 		= conffile.get_option("tex-environment-filter");
 	options_.sgml_attributes_to_check_
 		= conffile.get_option("sgml-attributes-to-check");
-	// Start spell checking engine
-	try {
+	// Start spell checking engine. It is initialized in the background
+	// while the rest of the setup is done.
+	{
+		StartupProfile::Phase phase("spellchecker");
 		sp_ = new Spellchecker(
 			options_.spellchecker_entry_->get_library(), 
 			options_.spellchecker_entry_->get_dictionary(),
 			options_.spellchecker_entry_->get_encoding());
-	} catch (Error const& err) {
-		// Spellchecker failed to initialize: Spew error and try to
-		// launch ispell instead.
-		std::cerr << err.what() << std::endl;
-		launch_old_ispell(ispell);
 	}
 	// Prepare encoding
 	delete user_conv_;
@@ -137,10 +160,16 @@ void IspellAlike::start()
 
 	// Load personal dictionary
 	try {
+		StartupProfile::Phase phase("personal_dictionary");
 		personal_dictionary_.load(options_.personal_dictionary_);
 	} catch (Error const& err) {
 	}
 
+	// Wait for the engine before starting the interface. The pipe
+	// interface waits only after printing its banner, so that the client
+	// need not wait for the engine to learn that tmispell is running.
+	if (options_.mode_ != Options::pipe) wait_ready(false);
+
 	// Start the wanted interface
 	switch (options_.mode_)
 	{
@@ -159,11 +188,19 @@ void IspellAlike::start()
 		i.start();
 	} break;
 
+	case Options::batch: {
+		BatchInterface i(*this);
+		i.start();
+	} break;
+
 	default:
 		// This should never happen: no need to localize
 		throw Error("FIXME: Mode unsupported");
 	}
 
+	// In case the interface never needed a filter
+	StartupProfile::get().finish();
+
 	// Save personal dictionary if necessary.
 	if (personal_dictionary_.is_changed()) {
 		try {
@@ -185,10 +222,14 @@ void throw_glib_convert_error_func(GError* gobject)
 	throw Glib::ConvertError(gobject);
 }
 
+#ifndef BENCH // The benchmarks have their own main
+
 int main(int argc, char* const* argv)
 {
 	try {
+		StartupProfile::get().begin("locale_init");
 		locale_init();
+		StartupProfile::get().end("locale_init");
 
 		{
 			Glib::Error::register_init();
@@ -200,15 +241,20 @@ int main(int argc, char* const* argv)
 		}
 		
 
+		StartupProfile::get().begin("options");
 		IspellAlike ispellalike(argc, argv);
+		StartupProfile::get().end("options");
+
 		ispellalike.start();
-		return 0;
+		return ispellalike.exit_status();
 	} catch (Error const& err) {
 		std::cerr << err.what() << std::endl;
 		return -1;
 	}
 }
 
+#endif // BENCH
+
 
 
 /****************************************************************************/
@@ -216,19 +262,159 @@ int main(int argc, char* const* argv)
  ** @{
  **/
 
-bool IspellAlike::check_word(Glib::ustring const& str)
+/**
+ * Check a word. The words accepted by the user are looked up first, so
+ * that they never reach the spell checking engine.
+ *
+ * The engine is not shared between threads: each thread checking words
+ * passes its own, created with new_spellchecker().
+ */
+bool IspellAlike::check_word(Glib::ustring const& str, Spellchecker& sp)
 {
 	if (str.length() < options_.legal_word_length_) {
 		return true;
 	}
-	return sp_->check_word(str) ||
-		personal_dictionary_.check_word(str) ||
-		session_dictionary_.check_word(str);
+	return user_words_.check_word(str) || sp.check_word(str);
+}
+
+/**
+ * Create a spell checker engine like the one in use, and wait for it to be
+ * initialized.
+ * @throws Error If the engine cannot be initialized.
+ */
+Spellchecker* IspellAlike::new_spellchecker()
+{
+	Spellchecker* sp = new Spellchecker(
+		options_.spellchecker_entry_->get_library(),
+		options_.spellchecker_entry_->get_dictionary(),
+		options_.spellchecker_entry_->get_encoding());
+	try {
+		sp->wait_ready();
+	} catch (Error const& err) {
+		delete sp;
+		throw;
+	}
+	return sp;
+}
+
+/**
+ * The share of words checked by one thread: every step'th word starting
+ * from first.
+ */
+struct CheckJob
+{
+	IspellAlike* parent;
+	Spellchecker* sp;
+	std::vector<Glib::ustring> const* words;
+	std::vector<char>* misspelled;
+	size_t first;
+	size_t step;
+	bool failed;
+};
+
+/** Check the words of a job */
+static void run_check_job(CheckJob* job)
+{
+	for (size_t i = job->first; i < job->words->size(); i += job->step) {
+		(*job->misspelled)[i] =
+			!job->parent->check_word((*job->words)[i], *job->sp);
+	}
+}
+
+/** Check the words of a job in a thread. Errors are left to the caller. */
+static void* check_job_thread(void* p)
+{
+	CheckJob* job = static_cast<CheckJob*>(p);
+	try {
+		run_check_job(job);
+	} catch (...) {
+		job->failed = true;
+	}
+	return 0;
+}
+
+/**
+ * Check many words, and set misspelled[i] to nonzero if words[i] is
+ * misspelled. The words are divided among options().jobs_ threads, each
+ * with an engine of its own. If fewer engines or threads can be
+ * started, fewer are used.
+ *
+ * If a thread fails, its words are checked again in the calling thread,
+ * so that errors are thrown as they would be without threads.
+ */
+void IspellAlike::check_words(std::vector<Glib::ustring> const& words,
+			      std::vector<char>& misspelled)
+{
+	// Not worth a thread of its own
+	size_t const min_words_per_job = 256;
+
+	misspelled.assign(words.size(), 0);
+
+	size_t jobs = options_.jobs_;
+	if (jobs > words.size() / min_words_per_job)
+		jobs = words.size() / min_words_per_job;
+	if (jobs < 1) jobs = 1;
+
+	std::vector<Spellchecker*> engines;
+	engines.push_back(sp_);
+	while (engines.size() < jobs) {
+		try {
+			engines.push_back(new_spellchecker());
+		} catch (Error const& err) {
+			break;
+		}
+	}
+	jobs = engines.size();
+
+	std::vector<CheckJob> job(jobs);
+	std::vector<pthread_t> threads(jobs);
+	std::vector<bool> started(jobs, false);
+	for (size_t j = 0; j < jobs; ++j) {
+		job[j].parent = this;
+		job[j].sp = engines[j];
+		job[j].words = &words;
+		job[j].misspelled = &misspelled;
+		job[j].first = j;
+		job[j].step = jobs;
+		job[j].failed = false;
+	}
+
+	// The first job is run in this thread
+	for (size_t j = 1; j < jobs; ++j) {
+		started[j] = (pthread_create(&threads[j], 0, check_job_thread,
+					     &job[j]) == 0);
+	}
+	check_job_thread(&job[0]);
+	for (size_t j = 1; j < jobs; ++j) {
+		if (started[j])
+			pthread_join(threads[j], 0);
+		else
+			job[j].failed = true;
+	}
+	for (size_t j = 1; j < jobs; ++j) {
+		delete engines[j];
+	}
+
+	for (size_t j = 0; j < jobs; ++j) {
+		if (job[j].failed) {
+			job[j].sp = sp_;
+			run_check_job(&job[j]);
+		}
+	}
 }
 
+/**
+ * Create a filter. Startup is considered finished once the first filter
+ * exists, as the interface is then ready to check words.
+ */
 Filter* IspellAlike::create_filter(Options::FilterType type)
 {
-	return Filter::new_filter(type, options_);
+	StartupProfile::get().begin("filter");
+	Filter* filter = Filter::new_filter(type, options_);
+	StartupProfile::get().end("filter");
+
+	StartupProfile::get().finish();
+	return filter;
 }
 
 Filter* IspellAlike::create_default_filter()
@@ -252,6 +438,35 @@ std::ostream* IspellAlike::open_output()
 	}
 }
 
+/**
+ * Convert a span of bytes, such as a line of a mapped file, from the
+ * user-specified encoding. Valid UTF-8 in a UTF-8 encoding is copied as it
+ * is, reusing the storage of out.
+ */
+void IspellAlike::from_user(char const* begin, char const* end,
+			    Glib::ustring* out)
+{
+	if (user_is_utf8() && g_utf8_validate(begin, end - begin, 0)) {
+		out->assign(begin, end);
+	} else {
+		*out = from_user(std::string(begin, end));
+	}
+}
+
+/**
+ * Create a converter like the one used by from_user and to_user. As
+ * converters keep state, each thread needs a converter of its own.
+ */
+CharsetConverter* IspellAlike::new_user_converter() const
+{
+	if (!options_.user_encoding_.empty()) {
+		return new CharsetConverter(options_.user_encoding_.c_str());
+	}
+	std::string cset;
+	Glib::get_charset(cset);
+	return new CharsetConverter(cset.c_str());
+}
+
 void IspellAlike::stop_if_needed()
 {
 	if (options_.sigstop_at_eol_) {
@@ -282,4 +497,90 @@ void IspellAlike::launch_old_ispell(std::string const& ispell)
 		    ispell.c_str());
 }
 
+/**
+ * Launch the real ispell program after our banner has been printed. Its
+ * output goes through a child process that drops the banner ispell prints,
+ * so that the client sees only one. Its input is what is left unread of
+ * ours, which is all of it, as nothing is read before the engine is ready.
+ */
+void IspellAlike::launch_old_ispell_without_banner(std::string const& ispell)
+{
+	// With an output file, ispell overwrites it, banner and all
+	if (!options_.output_file_.empty()) {
+		launch_old_ispell(ispell);
+		return;
+	}
+
+	std::cout << std::flush;
+	fflush(stdout);
+
+	int fds[2];
+	if (pipe(fds) != 0) {
+		throw Error("Unable to start the ispell program (%s)",
+			    ispell.c_str());
+	}
+
+	pid_t pid = fork();
+	if (pid < 0) {
+		throw Error("Unable to start the ispell program (%s)",
+			    ispell.c_str());
+	} else if (pid == 0) {
+		// Copy ispell's output past its first line to ours
+		close(fds[1]);
+		close(STDIN_FILENO);
+
+		char buf[4096];
+		bool skipping = true;
+		ssize_t n;
+		while ((n = read(fds[0], buf, sizeof(buf))) != 0) {
+			if (n < 0) {
+				if (errno == EINTR) continue;
+				_exit(1);
+			}
+			char* p = buf;
+			if (skipping) {
+				char* nl = static_cast<char*>(
+					memchr(buf, '\n', n));
+				if (nl == 0) continue;
+				skipping = false;
+				p = nl + 1;
+			}
+			while (p < buf + n) {
+				ssize_t w = write(STDOUT_FILENO, p,
+						  buf + n - p);
+				if (w < 0 && errno == EINTR) continue;
+				if (w < 0) _exit(1);
+				p += w;
+			}
+		}
+		_exit(0);
+	}
+
+	dup2(fds[1], STDOUT_FILENO);
+	close(fds[0]);
+	close(fds[1]);
+	launch_old_ispell(ispell);
+}
+
+/**
+ * Wait for the spell checking engine to be initialized, and launch the real
+ * ispell instead if it cannot be.
+ * @param banner_printed Whether the pipe mode banner has been printed
+ *                       already, so that ispell's own has to be dropped
+ */
+void IspellAlike::wait_ready(bool banner_printed)
+{
+	try {
+		sp_->wait_ready();
+	} catch (Error const& err) {
+		// Spellchecker failed to initialize: Spew error and try to
+		// launch ispell instead.
+		std::cerr << err.what() << std::endl;
+		if (banner_printed)
+			launch_old_ispell_without_banner(ispell_);
+		else
+			launch_old_ispell(ispell_);
+	}
+}
+
 /** @} */
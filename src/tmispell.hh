@@ -56,7 +56,30 @@ public:
 	 */
 
 	/// Check if the given word is spelled correctly
-	bool check_word(Glib::ustring const& str);
+	bool check_word(Glib::ustring const& str)
+		{ return check_word(str, *sp_); }
+
+	/// Check a word with the given spell checker engine
+	bool check_word(Glib::ustring const& str, Spellchecker& sp);
+
+	/// Check a word with the given engine only, ignoring the personal and
+	/// session dictionaries. Safe while they are being changed.
+	bool check_engine_word(Glib::ustring const& str, Spellchecker& sp)
+		{ return str.length() < options_.legal_word_length_ ||
+			 sp.check_word(str); }
+
+	/// Check many words, in several threads if so wanted in options
+	void check_words(std::vector<Glib::ustring> const& words,
+			 std::vector<char>& misspelled);
+
+	/// Create another spell checker engine, for use in another thread
+	Spellchecker* new_spellchecker();
+
+	/// The spell checker engine of the main thread
+	Spellchecker& spellchecker() { return *sp_; }
+
+	/// Wait for the engine, falling back to ispell if it cannot be used
+	void wait_ready(bool banner_printed);
 
 	void get_suggestions(Glib::ustring const& str,
 			     std::vector<Glib::ustring>& suggestions)
@@ -87,6 +110,23 @@ public:
 	std::string to_user(Glib::ustring const& str)
 		{return user_conv_ ? user_conv_->to(str) : to_locale(str);}
 
+	/// Convert bytes from user-specified encoding to UTF-8 into out
+	void from_user(char const* begin, char const* end, Glib::ustring* out);
+
+	/// The length in bytes of UTF-8 text in the user-specified encoding
+	std::string::size_type user_length(Glib::ustring::const_iterator begin,
+					   Glib::ustring::const_iterator end)
+		{ return (user_conv_ ? *user_conv_ : CharsetConverter::locale())
+				.external_length(begin, end); }
+
+	/// Create a converter for the user-specified encoding
+	CharsetConverter* new_user_converter() const;
+
+	/// Is the user-specified encoding UTF-8
+	bool user_is_utf8()
+		{ return (user_conv_ ? *user_conv_
+			  : CharsetConverter::locale()).is_utf8(); }
+
 
 	/*
 	 * Convert input to or from the locale-specified encoding.
@@ -123,11 +163,20 @@ public:
 	
 	/// Get option information
 	Options const& options() const { return options_; }
+
+	/// Set the exit status of the program
+	void set_exit_status(int status) { exit_status_ = status; }
+
+	/// Get the exit status of the program
+	int exit_status() const { return exit_status_; }
 	
 private:
 	/// Launch the real ispell program instead
 	void launch_old_ispell(std::string const& ispell);
 
+	/// Launch the real ispell program, dropping its pipe mode banner
+	void launch_old_ispell_without_banner(std::string const& ispell);
+
 private:
 	/// Options supplied by the user and defaults
 	Options options_;
@@ -138,14 +187,23 @@ private:
 	/// Additional words accepted in this session
 	PersonalDictionary session_dictionary_;
 
+	/// The words accepted by the user: personal and session dictionaries
+	LayeredDictionary user_words_;
+
 	/// The spell checker
 	Spellchecker* sp_;
 
+	/// The real ispell program to fall back to
+	std::string ispell_;
+
 	/// The converter for the user-specified encoding
 	CharsetConverter* user_conv_;
 
 	/// Output channel
 	std::ostream* out_;
+
+	/// The exit status of the program
+	int exit_status_;
 };
 
 #endif // TMISPELL_HH_
@@ -0,0 +1,258 @@
+/* Copyright (C) Pauli Virtanen
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *********************************************************************************/
+
+/**
+ * @file batchui.cc
+ *
+ * A non-interactive interface that checks many files in parallel.
+ */
+#include <string>
+#include <vector>
+#include <iostream>
+#include <sstream>
+
+#include <glib.h>
+
+#include "batchui.hh"
+#include "tmispell.hh"
+
+#include "i18n.hh"
+#include "common.hh"
+#include "charset.hh"
+#include "mapped_file.hh"
+#include "json_writer.hh"
+
+#include "glibmm/ustring.h"
+
+BatchInterface::BatchInterface(IspellAlike& parent)
+	: parent_(parent), reports_(), next_file_(0)
+{
+	pthread_mutex_init(&lock_, 0);
+	pthread_cond_init(&report_done_, 0);
+}
+
+BatchInterface::~BatchInterface()
+{
+	pthread_cond_destroy(&report_done_);
+	pthread_mutex_destroy(&lock_);
+}
+
+/**
+ * Start the workers, and print the reports in the order of the files as
+ * they get done. The exit status is 1 if misspelled words were found, and
+ * 2 if some file could not be checked.
+ */
+void BatchInterface::start()
+{
+	typedef std::vector< std::pair<std::string, Options::FilterType> >
+		Files;
+	Files const& files = parent_.options().files_;
+	if (files.empty()) {
+		throw Error(_("No files to check"));
+	}
+
+	reports_.assign(files.size(), FileReport());
+	next_file_ = 0;
+
+	// The first worker uses the engine already initialized
+	size_t jobs = parent_.options().jobs_;
+	if (jobs > files.size()) jobs = files.size();
+	if (jobs < 1) jobs = 1;
+
+	std::vector<Worker> workers;
+	for (size_t i = 0; i < jobs; ++i) {
+		Worker w;
+		w.batch = this;
+		try {
+			w.sp = (i == 0) ? &parent_.spellchecker()
+				: parent_.new_spellchecker();
+		} catch (Error const& err) {
+			break;
+		}
+		workers.push_back(w);
+	}
+
+	size_t started = 0;
+	for (size_t i = 0; i < workers.size(); ++i) {
+		workers[i].started = (pthread_create(&workers[i].thread, 0,
+						     worker_thread,
+						     &workers[i]) == 0);
+		if (workers[i].started) ++started;
+	}
+
+	// No threads: check everything here before printing
+	if (started == 0) run_worker(*workers[0].sp);
+
+	int status = 0;
+	for (size_t i = 0; i < files.size(); ++i) {
+		pthread_mutex_lock(&lock_);
+		while (!reports_[i].done)
+			pthread_cond_wait(&report_done_, &lock_);
+		pthread_mutex_unlock(&lock_);
+
+		FileReport& report = reports_[i];
+		print_report(report);
+		if (report.failed) status = 2;
+		else if (report.misspelled && status == 0) status = 1;
+	}
+
+	for (size_t i = 0; i < workers.size(); ++i) {
+		if (workers[i].started)
+			pthread_join(workers[i].thread, 0);
+		if (i > 0) delete workers[i].sp;
+	}
+
+	parent_.set_exit_status(status);
+}
+
+void* BatchInterface::worker_thread(void* p)
+{
+	Worker* w = static_cast<Worker*>(p);
+	w->batch->run_worker(*w->sp);
+	return 0;
+}
+
+/**
+ * Take files from the queue and check them. Each worker has a character
+ * set converter of its own, as it may not be shared between threads. A
+ * new filter is made for each file, so that no state of the filter, such
+ * as an unclosed comment, carries over to the next file.
+ */
+void BatchInterface::run_worker(Spellchecker& sp)
+{
+	ScopedPtr<CharsetConverter> conv(parent_.new_user_converter());
+
+	Options const& options = parent_.options();
+
+	for (;;) {
+		pthread_mutex_lock(&lock_);
+		size_t i = next_file_++;
+		pthread_mutex_unlock(&lock_);
+		if (i >= options.files_.size()) break;
+
+		std::string const& file = options.files_[i].first;
+		Options::FilterType type = options.files_[i].second;
+
+		FileReport report;
+		try {
+			ScopedPtr<Filter> filter(
+				Filter::new_filter(type, options));
+			check_file(file, filter.get(), sp, *conv, report);
+		} catch (Error const& err) {
+			report.failed = true;
+			report.error = err.what();
+		} catch (...) {
+			report.failed = true;
+		}
+		if (report.failed && report.error.empty()) {
+			report.error = ssprintf(_("Unable to check file %s"),
+						file.c_str());
+		}
+
+		pthread_mutex_lock(&lock_);
+		reports_[i].output.swap(report.output);
+		reports_[i].error.swap(report.error);
+		reports_[i].misspelled = report.misspelled;
+		reports_[i].failed = report.failed;
+		reports_[i].done = true;
+		pthread_cond_broadcast(&report_done_);
+		pthread_mutex_unlock(&lock_);
+	}
+}
+
+/**
+ * Check a file, appending a line to the report for each misspelled word.
+ * Columns are counted in characters from 1, advancing from the previous
+ * word on the line, so that long lines are not scanned over and over.
+ *
+ * With --json, a JSON Lines record is appended instead, with the byte and
+ * character offsets of the word from the start of the line, and the
+ * suggestions for it.
+ */
+void BatchInterface::check_file(std::string const& file, Filter* filter,
+				Spellchecker& sp, CharsetConverter& conv,
+				FileReport& report)
+{
+	MappedFile in(file);
+	bool utf8 = conv.is_utf8();
+	bool json = parent_.options().json_;
+	JsonWriter json_out;
+
+	Glib::ustring line;
+	char const* begin;
+	char const* end;
+	unsigned long lineno = 0;
+
+	while (in.next_line(&begin, &end)) {
+		++lineno;
+		if (utf8 && g_utf8_validate(begin, end - begin, 0))
+			line.assign(begin, end);
+		else
+			line = conv.from(std::string(begin, end));
+
+		filter->set_line(&line);
+
+		Glib::ustring::const_iterator col_pos = line.begin();
+		unsigned long col = 1;
+		unsigned long byte = 0;
+		Glib::ustring::const_iterator word_begin, word_end;
+		while (filter->next_word(&word_begin, &word_end)) {
+			Glib::ustring word(filter->word_text(word_begin, word_end));
+			if (parent_.check_word(word, sp)) continue;
+
+			if (json) byte += conv.external_length(col_pos, word_begin);
+			for (; col_pos != word_begin; ++col_pos) ++col;
+			report.misspelled = true;
+
+			if (json) {
+				std::vector<Glib::ustring> suggestions;
+				sp.get_suggestions(word, suggestions);
+
+				json_out.begin("misspelling");
+				json_out.field("file", file);
+				json_out.field("line", lineno);
+				json_out.field("byte", byte);
+				json_out.field("char", col - 1);
+				json_out.field("word", word);
+				json_out.field("suggestions", suggestions);
+				json_out.end();
+				continue;
+			}
+
+			std::ostringstream pos;
+			pos << ':' << lineno << ':' << col << ": ";
+			report.output += file;
+			report.output += pos.str();
+			report.output += utf8 ? word.raw() : conv.to(word);
+			report.output += '\n';
+		}
+	}
+
+	if (json) report.output.swap(json_out.buffer());
+}
+
+void BatchInterface::print_report(FileReport& report)
+{
+	std::cout.write(report.output.data(), report.output.size());
+	std::cout.flush();
+	if (report.failed) {
+		std::cerr << report.error << std::endl;
+	}
+
+	// Free the memory as soon as possible
+	std::string().swap(report.output);
+}
@@ -0,0 +1,109 @@
+/* Copyright (C) Pauli Virtanen
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *********************************************************************************/
+
+/**
+ * @file batchui.hh
+ *
+ * A non-interactive interface that checks many files in parallel.
+ */
+#ifndef BATCHUI_HH_
+#define BATCHUI_HH_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <pthread.h>
+
+#include "tmispell.hh"
+
+/**
+ * An interface that checks the files given on the command line and
+ * reports the misspelled words with their positions, as
+ *
+ *   file:line:column: word
+ *
+ * The files are checked by a pool of threads, each with a spell checker
+ * engine and filters of its own. The reports are printed in the order of
+ * the files.
+ */
+class BatchInterface
+{
+public:
+	BatchInterface(IspellAlike& parent);
+	~BatchInterface();
+
+	void start();
+
+private:
+	/// The report of one file
+	struct FileReport
+	{
+		FileReport() : done(false), misspelled(false), failed(false) {}
+
+		/// The lines to print
+		std::string output;
+		/// The error message to print, if failed
+		std::string error;
+		/// Has the file been checked
+		bool done;
+		/// Were misspelled words found
+		bool misspelled;
+		/// Could the file not be checked
+		bool failed;
+	};
+
+	/// The state of one worker thread
+	struct Worker
+	{
+		BatchInterface* batch;
+		Spellchecker* sp;
+		pthread_t thread;
+		bool started;
+	};
+
+	/// Check files from the queue until there are none left
+	void run_worker(Spellchecker& sp);
+
+	/// Thread entry point of a worker
+	static void* worker_thread(void* worker);
+
+	/// Check one file
+	void check_file(std::string const& file, Filter* filter,
+			Spellchecker& sp, CharsetConverter& conv,
+			FileReport& report);
+
+	/// Print a finished report
+	void print_report(FileReport& report);
+
+private:
+	IspellAlike& parent_;
+
+	/// The reports, in the order of the files
+	std::vector<FileReport> reports_;
+
+	/// The index of the next file to check
+	size_t next_file_;
+
+	/// Protects next_file_ and reports_
+	pthread_mutex_t lock_;
+
+	/// Signaled when a report is done
+	pthread_cond_t report_done_;
+};
+
+#endif // BATCHUI_HH_
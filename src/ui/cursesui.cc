@@ -23,19 +23,24 @@
  * Quite a direct cloning of the Ispell interface.
  */
 #include <string>
-#include <fstream>
 #include <algorithm>
 #include <vector>
 
 #include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
+#include <fcntl.h>
 #include <ncursesw/curses.h>
 #include <signal.h>
+#include <sys/stat.h>
+
+#include <glib.h>
 
 #include "i18n.hh"
 #include "common.hh"
+#include "charset.hh"
 #include "cursesui.hh"
 #include "cursesui_pimpl.hh"
 
@@ -195,7 +200,7 @@ void CursesInterface::Pimpl::redraw_minimenu()
 	werase(minimenu_w_);
 	wmove(minimenu_w_, 0, 0);
 	wprintw(minimenu_w_, "%s",
-		parent_.to_locale(_("[SP] <number> R)epl A)ccept I)nsert L)ookup U)ncap Q)uit "
+		parent_.to_locale(_("[SP] <number> R)epl E)very A)ccept I)nsert L)ookup U)ncap Q)uit "
 				    "e(X)it or ? for help")).c_str());
 	wrefresh(minimenu_w_);
 }
@@ -233,6 +238,8 @@ void CursesInterface::Pimpl::show_help()
 		  "\n"
 		  "Commands are:\n"
 		  " r       Replace the misspelled word completely.\n"
+		  " e       Replace the word, and every later occurrence of it\n"
+		  "         in this file.\n"
 		  " space   Accept the word this time only.\n"
 		  " a       Accept the word for the rest of this session.\n"
 		  " i       Accept the word, and put it in your personal dictionary.\n"
@@ -289,8 +296,8 @@ std::string CursesInterface::Pimpl::prompt(std::string const& prompt,
 /** Yes or no keys */
 static char const* keys_yes_no = N_("yn");
 
-/** Control keys: Add Insert Uncap Quit eXit Replace */
-static char const* keys_control = N_("aiuqxr");
+/** Control keys: Add Insert Uncap Quit eXit Replace replace Every */
+static char const* keys_control = N_("aiuqxre");
 
 #define CKEY_YES     keys_yes_no[0]
 #define CKEY_NO      keys_yes_no[1]
@@ -302,6 +309,7 @@ static char const* keys_control = N_("aiuqxr");
 #define CKEY_QUIT    keys_control[3]
 #define CKEY_EXIT    keys_control[4]
 #define CKEY_REPLACE keys_control[5]
+#define CKEY_REPLACE_ALL keys_control[6]
 #define CKEY_HELP    '?'
 
 #define IS_KEY(k, w) (tolower(k) == tolower(w))
@@ -324,7 +332,7 @@ public:
 bool CursesInterface::Pimpl::handle_misspelled()
 {
 	suggestions_.clear();
-	parent_.get_suggestions(context_->word(), suggestions_);
+	lookahead_->get_suggestions(context_->word(), suggestions_);
 
 	redraw_word();
 	redraw_context();
@@ -342,15 +350,18 @@ bool CursesInterface::Pimpl::handle_misspelled()
 		// Add to session dictionary
 		else if (IS_KEY(key, CKEY_ADD)) {
 			parent_.add_session_word(word);
+			lookahead_->skip(word);
 			return true;
 		}
 		// Add to personal dictionary
 		else if (IS_KEY(key, CKEY_INSERT)) {
 			parent_.add_personal_word(word);
+			lookahead_->skip(word);
 			return true;
 		}
 		// Add to personal dictionary, in lowercase
 		else if (IS_KEY(key, CKEY_UNCAP)) {
+			lookahead_->skip(word);
 			tolower(word);
 			parent_.add_personal_word(word);
 			return true;
@@ -378,6 +389,17 @@ bool CursesInterface::Pimpl::handle_misspelled()
 			dirty_ = true;
 			return true;
 		}
+		// Replace this and the later occurrences
+		else if (IS_KEY(key, CKEY_REPLACE_ALL)) {
+			std::string rep = prompt(_("Replace every occurrence "
+						   "with: "), 512);
+			Glib::ustring replacement = parent_.from_locale(rep);
+			replacements_[word.raw()] = replacement;
+			lookahead_->skip(word);
+			context_->replace_word(replacement, false);
+			dirty_ = true;
+			return true;
+		}
 		// Show help
 		else if (IS_KEY(key, CKEY_HELP)) {
 			show_help();
@@ -401,6 +423,195 @@ bool CursesInterface::Pimpl::handle_misspelled()
 	return false;
 }
 
+/**
+ * The corrected version of a file, written to a temporary file in the same
+ * directory and renamed over the original, so that the original is never
+ * left half written. If no temporary file can be created there, an
+ * anonymous one is used, and copied over the original. Symbolic links
+ * are followed, and a file with other hard links or an owner that cannot
+ * be kept is copied over too.
+ *
+ * The temporary file is removed if it is not committed.
+ */
+class ReplacementFile
+{
+public:
+	/// Open a temporary file for replacing the given file
+	ReplacementFile(std::string const& file);
+
+	/// Close and remove the temporary file, if it was not committed
+	~ReplacementFile();
+
+	/// The stream to write the corrected version to
+	FILE* stream() { return out_; }
+
+	/// Replace the original file, leaving it in file.bak if so wanted
+	void commit(bool backup);
+
+private:
+	/// Copy the temporary file over the original
+	void copy_over();
+
+	/// The file to replace, as given
+	std::string file_;
+
+	/// The file to replace, with symbolic links resolved
+	std::string target_;
+
+	/// The name of the temporary file, or empty if it is anonymous
+	std::string temp_;
+
+	/// The temporary file
+	FILE* out_;
+};
+
+/**
+ * @throws Error If no temporary file can be opened.
+ */
+ReplacementFile::ReplacementFile(std::string const& file)
+	: file_(file), target_(file), temp_(), out_(0)
+{
+	char* resolved = realpath(file.c_str(), 0);
+	if (resolved) {
+		target_ = resolved;
+		free(resolved);
+	}
+
+	std::vector<char> name(target_.begin(), target_.end());
+	char const suffix[] = ".XXXXXX";
+	name.insert(name.end(), suffix, suffix + sizeof(suffix));
+
+	int fd = mkstemp(&name[0]);
+	if (fd >= 0) {
+		out_ = fdopen(fd, "w+");
+		if (out_) {
+			temp_ = &name[0];
+		} else {
+			close(fd);
+			unlink(&name[0]);
+		}
+	}
+
+	if (!out_) out_ = tmpfile();
+	if (!out_) {
+		throw Error(_("Unable to open temporary file"));
+	}
+}
+
+ReplacementFile::~ReplacementFile()
+{
+	if (out_) fclose(out_);
+	if (!temp_.empty()) unlink(temp_.c_str());
+}
+
+/** Copy the file from to the file to. Return false on failure. */
+static bool copy_file(std::string const& from, std::string const& to)
+{
+	FILE* in = fopen(from.c_str(), "r");
+	if (!in) return false;
+	FILE* out = fopen(to.c_str(), "w");
+	if (!out) {
+		fclose(in);
+		return false;
+	}
+
+	char buf[65536];
+	size_t readen;
+	bool ok = true;
+	while ((readen = fread(buf, 1, sizeof(buf), in)) > 0) {
+		if (fwrite(buf, 1, readen, out) != readen) ok = false;
+	}
+	ok = !ferror(in) && ok;
+	fclose(in);
+	return (fclose(out) == 0) && ok;
+}
+
+/**
+ * Give the temporary file the owner and permissions of the original,
+ * write it to disk, and rename it over the original. A backup is made as
+ * a hard link to the original, so that the original name always refers
+ * to a complete file. If the original has other hard links, or its owner
+ * cannot be given to the temporary file, the temporary file is copied
+ * over the original instead.
+ * @throws Error If the file cannot be written.
+ */
+void ReplacementFile::commit(bool backup)
+{
+	std::string backup_file = file_ + ".bak";
+
+	if (temp_.empty()) {
+		if (backup) rename(file_.c_str(), backup_file.c_str());
+		copy_over();
+		return;
+	}
+
+	int fd = fileno(out_);
+	struct stat st;
+	if (stat(target_.c_str(), &st) == 0) {
+		if (st.st_nlink > 1 ||
+		    fchown(fd, st.st_uid, st.st_gid) != 0) {
+			if (backup) copy_file(target_, backup_file);
+			copy_over();
+			return;
+		}
+		fchmod(fd, st.st_mode & 07777);
+	}
+
+	if (fflush(out_) != 0 || ferror(out_) || fsync(fd) != 0) {
+		throw Error(_("Unable to write file %s"), temp_.c_str());
+	}
+
+	if (backup) {
+		unlink(backup_file.c_str());
+		if (link(target_.c_str(), backup_file.c_str()) != 0)
+			copy_file(target_, backup_file);
+	}
+
+	if (rename(temp_.c_str(), target_.c_str()) != 0) {
+		throw Error(_("Unable to write file %s"), file_.c_str());
+	}
+	temp_.clear();
+
+	// Write the new directory entry to disk, too. Not all file systems
+	// can sync a directory, and the file is already in place, so errors
+	// are ignored.
+	std::string::size_type slash = target_.rfind('/');
+	std::string dir = (slash == std::string::npos) ? std::string(".")
+		: (slash == 0) ? std::string("/") : target_.substr(0, slash);
+	int dir_fd = open(dir.c_str(), O_RDONLY);
+	if (dir_fd >= 0) {
+		fsync(dir_fd);
+		close(dir_fd);
+	}
+}
+
+/**
+ * Copy the temporary file over the original.
+ * @throws Error If the file cannot be written.
+ */
+void ReplacementFile::copy_over()
+{
+	rewind(out_);
+	FILE* newout = fopen(target_.c_str(), "w");
+	if (!newout) {
+		throw Error(_("Unable to write file %s"), file_.c_str());
+	}
+
+	char buf[65536];
+	size_t readen;
+	while ((readen = fread(buf, 1, sizeof(buf), out_)) > 0) {
+		if (fwrite(buf, 1, readen, newout) != readen) {
+			fclose(newout);
+			throw Error(_("Unable to write file %s"),
+				    file_.c_str());
+		}
+	}
+
+	if (ferror(out_) || fclose(newout) != 0) {
+		throw Error(_("Unable to write file %s"), file_.c_str());
+	}
+}
+
 /**
  * Check the spelling of a given file with given filter and replace
  * it with corrected version, if QuitException does not happen.
@@ -409,22 +620,15 @@ bool CursesInterface::Pimpl::handle_misspelled()
 void CursesInterface::Pimpl::check_file(std::string const& file,
 					Options::FilterType type)
 {
-	// Open input file
-	std::ifstream in(file.c_str());
-	if (!in) throw Error(_("Unable to open file %s"), file.c_str());
+	// Map input file. It is unmapped before the file is replaced.
+	ScopedPtr<MappedFile> in(new MappedFile(file));
 
-	// Open output file
-	// FIXME: Here I happily use stdio and iostream mixed...
-	FILE* out;
-	{
-		out = tmpfile();
-		if (!out) {
-			throw Error(_("Unable to open temporary file"));
-		}
-	}
+	// Open output file, next to the input file
+	ReplacementFile out(file);
 
 	// Display that we are editing a new file: indicate it
 	dirty_ = false;
+	replacements_.clear();
 	file_ = file;
 	redraw_file();
 
@@ -437,11 +641,28 @@ void CursesInterface::Pimpl::check_file(std::string const& file,
 	filter_ = parent_.create_filter(type);
 
 	context_ = new Context(filter_, get_context_line_count(),
-			       in, out, parent_);
+			       *in, out.stream(), parent_);
+
+	// Find the next misspellings in the background
+	ScopedPtr<Lookahead> lookahead(
+		new Lookahead(parent_, type, *in, lookahead_sp_));
+	lookahead_ = lookahead.get();
 
 	// Read lines
 	while (context_->next_word())
 	{
+		lookahead_->advance(in->position());
+
+		// Replace the words the user asked to be replaced everywhere.
+		// The replacements are not checked again.
+		Replacements::const_iterator r =
+			replacements_.find(context_->word().raw());
+		if (r != replacements_.end()) {
+			context_->replace_word(r->second, false);
+			dirty_ = true;
+			continue;
+		}
+
 		if (!parent_.check_word(context_->word())) {
 			if (!handle_misspelled()) {
 				context_->flush();
@@ -453,28 +674,14 @@ void CursesInterface::Pimpl::check_file(std::string const& file,
 	delete context_;
 	context_ = 0;
 
-	in.close();
+	lookahead.reset();
+	lookahead_ = 0;
+	in.reset();
 
 	// If the file was changed, save changes
 	if (dirty_) {
-		// Make backup if wanted
-		if (parent_.options().backups_) {
-			std::string backup = file + ".bak";
-			rename(file.c_str(), backup.c_str());
-		}
-		
-		// Then replace the original
-		rewind(out);
-		std::ofstream newout(file.c_str());
-		char buf[1024];
-		size_t readen;
-		while ((readen = fread(buf, 1, 1024, out)) > 0) {
-			newout.write(buf, readen);
-		}
+		out.commit(parent_.options().backups_);
 	}
-	
-	// Cleanup
-	fclose(out);
 }
 
 /** @} */
@@ -572,7 +779,8 @@ void CursesInterface::Pimpl::start()
  * Just init data.
  */
 CursesInterface::Pimpl::Pimpl(IspellAlike& parent)
-	: parent_(parent), file_(), context_(0), filter_(0), dirty_(false),
+	: parent_(parent), file_(), context_(0), lookahead_(0),
+	  lookahead_sp_(0), filter_(0), dirty_(false),
 	  word_w_(0), file_w_(0), context_w_(0), minimenu_w_(0), input_w_(0)
 {
 }
@@ -583,16 +791,171 @@ CursesInterface::Pimpl::Pimpl(IspellAlike& parent)
 CursesInterface::Pimpl::~Pimpl()
 {
 	delete filter_;
+	delete lookahead_sp_;
 	curses_cleanup();
 }
 
 /** @} */
 
 
+/*****************************************************************************/
+/** @name Lookahead
+ ** @{
+ **/
+
+/**
+ * Start a thread scanning the file. If the thread cannot be started, the
+ * suggestions are simply computed when asked for.
+ */
+Lookahead::Lookahead(IspellAlike& parent, Options::FilterType type,
+		     MappedFile const& in, Spellchecker*& engine)
+	: parent_(parent), type_(type), data_(in.data()), size_(in.size()),
+	  engine_(engine), cache_(), skip_(), pending_(), position_(0),
+	  stop_(false), started_(false)
+{
+	pthread_mutex_init(&lock_, 0);
+	pthread_cond_init(&wake_, 0);
+	started_ = (pthread_create(&thread_, 0, scan_thread, this) == 0);
+}
+
+/**
+ * Stop the thread. It stops at the next line, or after the suggestions
+ * it is computing.
+ */
+Lookahead::~Lookahead()
+{
+	if (started_) {
+		pthread_mutex_lock(&lock_);
+		stop_ = true;
+		pthread_cond_signal(&wake_);
+		pthread_mutex_unlock(&lock_);
+		pthread_join(thread_, 0);
+	}
+	pthread_cond_destroy(&wake_);
+	pthread_mutex_destroy(&lock_);
+}
+
+/**
+ * Let the thread go on, if misspellings before the position were waiting.
+ * Only the lines past the position are scanned from now on.
+ */
+void Lookahead::advance(size_t position)
+{
+	pthread_mutex_lock(&lock_);
+	if (position != position_) {
+		position_ = position;
+		while (!pending_.empty() && pending_.front() < position_)
+			pending_.pop_front();
+		pthread_cond_signal(&wake_);
+	}
+	pthread_mutex_unlock(&lock_);
+}
+
+/**
+ * Stop looking for a word, as the user accepted or replaced it everywhere.
+ */
+void Lookahead::skip(Glib::ustring const& word)
+{
+	pthread_mutex_lock(&lock_);
+	skip_.insert(word.raw());
+	cache_.erase(word.raw());
+	pthread_mutex_unlock(&lock_);
+}
+
+void Lookahead::get_suggestions(Glib::ustring const& word,
+				std::vector<Glib::ustring>& suggestions)
+{
+	pthread_mutex_lock(&lock_);
+	Cache::const_iterator i = cache_.find(word.raw());
+	bool found = (i != cache_.end());
+	if (found) suggestions = i->second;
+	pthread_mutex_unlock(&lock_);
+
+	if (!found) parent_.get_suggestions(word, suggestions);
+}
+
+void* Lookahead::scan_thread(void* p)
+{
+	try {
+		static_cast<Lookahead*>(p)->scan();
+	} catch (...) {
+		// Then the suggestions are computed when asked for
+	}
+	return 0;
+}
+
+/**
+ * Scan the lines of the file, and compute the suggestions for each
+ * distinct misspelled word. The lines already read by the Context are
+ * only filtered, to keep the state of the filter. The words known already,
+ * or accepted or replaced by the user, are not checked again.
+ */
+void Lookahead::scan()
+{
+	if (engine_ == 0) engine_ = parent_.new_spellchecker();
+	Spellchecker& sp = *engine_;
+
+	ScopedPtr<Filter> filter(Filter::new_filter(type_,
+						 parent_.options()));
+	ScopedPtr<CharsetConverter> conv(parent_.new_user_converter());
+	bool utf8 = conv->is_utf8();
+
+	Glib::ustring line;
+	char const* end = data_ + size_;
+	char const* begin;
+	for (begin = data_; begin < end; ) {
+		char const* eol = static_cast<char const*>(
+			memchr(begin, '\n', end - begin));
+		if (eol == 0) eol = end;
+		size_t offset = begin - data_;
+
+		pthread_mutex_lock(&lock_);
+		while (!stop_ && pending_.size() >= max_ahead)
+			pthread_cond_wait(&wake_, &lock_);
+		bool stop = stop_;
+		bool skip = (offset < position_);
+		pthread_mutex_unlock(&lock_);
+		if (stop) break;
+
+		if (utf8 && g_utf8_validate(begin, eol - begin, 0))
+			line.assign(begin, eol);
+		else
+			line = conv->from(std::string(begin, eol));
+		begin = eol + 1;
+
+		filter->set_line(&line);
+		Glib::ustring::const_iterator word_begin, word_end;
+		while (filter->next_word(&word_begin, &word_end)) {
+			if (skip) continue;
+
+			Glib::ustring word(filter->word_text(word_begin, word_end));
+
+			pthread_mutex_lock(&lock_);
+			bool known = (cache_.find(word.raw()) != cache_.end() ||
+				      skip_.find(word.raw()) != skip_.end());
+			pthread_mutex_unlock(&lock_);
+			if (known) continue;
+
+			if (parent_.check_engine_word(word, sp)) continue;
+
+			std::vector<Glib::ustring> suggestions;
+			sp.get_suggestions(word, suggestions);
+
+			pthread_mutex_lock(&lock_);
+			cache_[word.raw()].swap(suggestions);
+			if (offset >= position_) pending_.push_back(offset);
+			pthread_mutex_unlock(&lock_);
+		}
+	}
+}
+
+/** @} */
+
+
 /*****************************************************************************/
 /** @name Context
  **
- ** FIXME: Will happily clobber CRLF to LF due to usage of std::getline.
+ ** FIXME: Will happily clobber CRLF to LF, as lines are split at LF.
  ** FIXME: This implementation is a bit too complex.
  ** @{
  **/
@@ -601,10 +964,10 @@ CursesInterface::Pimpl::~Pimpl()
  * Construct a new text context line buffer.
  * @param filter The filter to extract words with.
  * @param extra_lines How many lines of context to store.
- * @param in The input stream.
+ * @param in The input file.
  * @param out The output stream.
  */
-Context::Context(Filter* filter, int extra_lines, std::istream& in, FILE* out,
+Context::Context(Filter* filter, int extra_lines, MappedFile& in, FILE* out,
 		 IspellAlike& parent)
 	: parent_(parent), in_(in), out_(out), filter_(filter),
 	  nlines_(1), current_pos_(0), current_(end()),
@@ -627,9 +990,11 @@ Context::Context(Filter* filter, int extra_lines, std::istream& in, FILE* out,
  */
 void Context::fill_buffer()
 {
-	std::string line;
-	while ((signed)size() < nlines_ && std::getline(in_, line)) {
-		push_back(parent_.from_user(line));
+	char const* begin;
+	char const* end;
+	while ((signed)size() < nlines_ && in_.next_line(&begin, &end)) {
+		push_back(Glib::ustring());
+		parent_.from_user(begin, end, &back());
 	}
 }
 
@@ -655,12 +1020,8 @@ bool Context::flush_first()
  */
 void Context::flush()
 {
-	char buf[1024];
-	size_t readen;
 	while (flush_first());
-	while ((readen = in_.rdbuf()->sgetn(buf, 1024)) > 0) {
-		fwrite(buf, 1, readen, out_);
-	}
+	in_.write_rest(out_);
 }
 
 /**
@@ -687,7 +1048,7 @@ bool Context::next_word()
 {
 	while (!empty())
 	{
-		if (filter_->get_next_word(&word_begin_, &word_end_)) {
+		if (filter_->next_word(&word_begin_, &word_end_)) {
 			return true;
 		} else {
 			if (current_pos_ >= (nlines_+1)/2-1) {
@@ -710,19 +1071,26 @@ bool Context::next_word()
 }
 
 /**
- * Replace the current word with given string.
+ * Replace the current word with given string. The next word is looked for
+ * from the start of the replacement, if it is to be checked, or else from
+ * its end.
+ *
+ * The word is located by its byte offset in the line, so that the cost
+ * does not grow with the number of characters before it on long lines.
  */
-void Context::replace_word(Glib::ustring const& replacement)
+void Context::replace_word(Glib::ustring const& replacement, bool check)
 {
-	int pos = std::distance(
-		static_cast<Glib::ustring::const_iterator>(current_->begin()),
-		word_begin_);
-	current_->replace(pos, std::distance(word_begin_, word_end_),
-			  replacement);
+	std::string::size_type offset =
+		word_begin_.base() - current_->raw().begin();
+	std::string::size_type length = word_end_.base() - word_begin_.base();
+
+	Glib::ustring::iterator begin(current_->begin().base() + offset);
+	Glib::ustring::iterator end(begin.base() + length);
+	current_->replace(begin, end, replacement);
 
-	Glib::ustring::const_iterator i = current_->begin();
-	std::advance(i, pos);
-	filter_->reset(i);
+	if (!check) offset += replacement.bytes();
+	filter_->reset(Glib::ustring::const_iterator(
+			       current_->raw().begin() + offset));
 }
 
 /**
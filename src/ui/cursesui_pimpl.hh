@@ -28,13 +28,18 @@
 #include <string>
 #include <vector>
 #include <list>
+#include <map>
+#include <set>
+#include <deque>
 
 #include <stdio.h>
+#include <pthread.h>
 
 #include <ncursesw/curses.h>
 
 #include "cursesui.hh"
 #include "tmispell.hh"
+#include "mapped_file.hh"
 
 /**
  * Storage of context text lines.
@@ -43,7 +48,7 @@ class Context : public std::list<Glib::ustring>
 {
 public:
 	/// Construct a context buffer
-	Context(Filter* filter_, int extra_lines, std::istream& in, FILE* out,
+	Context(Filter* filter_, int extra_lines, MappedFile& in, FILE* out,
 		IspellAlike& parent);
 
 	/// Destroy a context buffer
@@ -57,7 +62,7 @@ public:
 
 	/// The current word
 	Glib::ustring word() const {
-		return Glib::ustring(word_begin_,word_end_);
+		return filter_->word_text(word_begin_, word_end_);
 	}
 
 	/// Iterator to the current line
@@ -69,8 +74,9 @@ public:
 	/// Iterator to the end of the current word
 	Glib::ustring::const_iterator word_end() const { return word_end_; }
 
-	/// Replace the current word with the given string
-	void replace_word(Glib::ustring const& replacement);
+	/// Replace the current word with the given string, and check the
+	/// replacement too if so wanted
+	void replace_word(Glib::ustring const& replacement, bool check = true);
 
 	/// Flush remaining data from buffers and input to output
 	void flush();
@@ -86,8 +92,8 @@ private:
 	/// The spell checker engine to use
 	IspellAlike& parent_;
 
-	/// Input stream
-	std::istream& in_;
+	/// Input file
+	MappedFile& in_;
 
 	/// Output stream
 	FILE* out_;
@@ -111,6 +117,92 @@ private:
 	Glib::ustring::const_iterator word_end_;
 };
 
+/**
+ * Scans a file ahead of the user in a thread of its own, and computes the
+ * suggestions for the misspelled words found, so that they are ready when
+ * the user gets to them.
+ *
+ * The thread has a spell checker engine, a filter and a character set
+ * converter of its own, and reads the mapped file independently of the
+ * Context. It consults only the engine, as the personal and session
+ * dictionaries change under it; the interface still checks each word
+ * itself, and the suggestions found here are only a cache. The thread
+ * stays at most max_ahead misspellings ahead of the read position of the
+ * Context.
+ */
+class Lookahead
+{
+public:
+	/// Start scanning the file, with the given engine or a new one
+	Lookahead(IspellAlike& parent, Options::FilterType type,
+		  MappedFile const& in, Spellchecker*& engine);
+
+	/// Stop scanning
+	~Lookahead();
+
+	/// Tell the read position of the Context in the file
+	void advance(size_t position);
+
+	/// Stop looking for a word accepted or replaced everywhere
+	void skip(Glib::ustring const& word);
+
+	/// Get the suggestions for a misspelled word: from the cache, or
+	/// computed now if not found there
+	void get_suggestions(Glib::ustring const& word,
+			     std::vector<Glib::ustring>& suggestions);
+
+private:
+	/// The number of misspellings to find ahead of the read position
+	enum { max_ahead = 8 };
+
+	/// Thread entry point
+	static void* scan_thread(void* lookahead);
+
+	/// Scan the file until its end or until stopped
+	void scan();
+
+	/// Map from a word to its suggestions
+	typedef std::map<std::string, std::vector<Glib::ustring> > Cache;
+
+	IspellAlike& parent_;
+
+	/// The type of filter to use
+	Options::FilterType type_;
+
+	/// The contents of the file
+	char const* data_;
+	size_t size_;
+
+	/// The engine of the thread, kept by the owner for the next file
+	Spellchecker*& engine_;
+
+	/// The suggestions for the misspelled words found
+	Cache cache_;
+
+	/// The words not to check
+	std::set<std::string> skip_;
+
+	/// The line offsets of the misspellings found past position_
+	std::deque<size_t> pending_;
+
+	/// The read position of the Context
+	size_t position_;
+
+	/// Should the thread stop
+	bool stop_;
+
+	/// Was the thread started
+	bool started_;
+
+	pthread_t thread_;
+
+	/// Protects everything above
+	pthread_mutex_t lock_;
+
+	/// Signaled when the thread may go on
+	pthread_cond_t wake_;
+};
+
 /**
  * A text-mode user interface.
  */
@@ -174,9 +266,21 @@ private:
 	/// The lines of context
 	Context* context_;
 
+	/// The lookahead of the file being checked, valid in check_file only
+	Lookahead* lookahead_;
+
+	/// The engine of the lookahead threads
+	Spellchecker* lookahead_sp_;
+
 	/// Suggestions
 	std::vector<Glib::ustring> suggestions_;
 
+	/// Map from a word to its replacement, applied to the rest of the file
+	typedef std::map<std::string, Glib::ustring> Replacements;
+
+	/// The words to replace everywhere in the file being checked
+	Replacements replacements_;
+
 	/// The filter currently in use
 	Filter* filter_;
 
@@ -23,39 +23,178 @@
  */
 
 #include <string>
+#include <vector>
+#include <map>
 #include <iostream>
 
+#include <unistd.h>
+
 #include "listui.hh"
 #include "tmispell.hh"
 
 #include "charset.hh"
+#include "mapped_file.hh"
 
 #include "glibmm/ustring.h"
 
 /**
  * Read words from stdin and print misspelled words to stdout.
  * They are always printed to stdout to be compatible w/ ispell.
+ *
+ * If stdin is a regular file, it is mapped to memory and its lines are
+ * scanned in place into a single line buffer.
+ *
+ * With --json, each misspelled word is written as a record
+ *
+ *   {"type":"misspelling","file":"-","line":1,"byte":0,"char":0,
+ *    "word":"...","suggestions":[...]}
+ *
+ * the offsets counted from the start of the line, the byte offset in the
+ * encoding of the input, and the text in UTF-8.
+ * With --unique and --count, the position is that of the first occurrence,
+ * and the number of occurrences is given as "count".
  */
 void ListInterface::start()
 {
-	Filter* filter = parent_.create_default_filter();
+	filter_ = parent_.create_default_filter();
+	utf8_ = parent_.user_is_utf8();
+	unique_ = parent_.options().unique_words_;
+	json_ = parent_.options().json_;
+	lineno_ = 0;
 
-	std::string line;
-	while (std::getline(std::cin, line))
+	MappedFile* input = MappedFile::map_fd(STDIN_FILENO);
+	if (input) {
+		Glib::ustring uline;
+		char const* begin;
+		char const* end;
+		while (input->next_line(&begin, &end)) {
+			parent_.from_user(begin, end, &uline);
+			check_line(uline);
+		}
+		delete input;
+	} else {
+		std::string line;
+		while (std::getline(std::cin, line)) {
+			check_line(parent_.from_user(line));
+		}
+	}
+
+	delete filter_;
+	filter_ = 0;
+
+	if (unique_) list_unique();
+	if (json_) json_out_.flush(std::cout);
+}
+
+void ListInterface::check_line(Glib::ustring const& line)
+{
+	filter_->set_line(&line);
+	++lineno_;
+	col_pos_ = line.begin();
+	col_ = 0;
+	byte_ = 0;
+
+	Glib::ustring::const_iterator begin, end;
+	while (filter_->next_word(&begin, &end))
 	{
-		Glib::ustring uline = parent_.from_user(line);
-		filter->set_line(&uline);
-
-		Glib::ustring::const_iterator begin, end;
-		while (filter->get_next_word(&begin, &end))
-		{
-			Glib::ustring word(begin, end);
-			if (!parent_.check_word(word)) {
-				std::cout << parent_.to_user(word)
-					  << std::endl;
+		Glib::ustring word(filter_->word_text(begin, end));
+		if (unique_) {
+			add_word(word, json_ ? locate(line, begin) : Position());
+		} else if (!parent_.check_word(word)) {
+			if (json_) {
+				write_json(word, locate(line, begin), 0);
+			} else {
+				print_word(word);
+				std::cout << std::endl;
 			}
 		}
 	}
+}
+
+/**
+ * Find the position of a word. The offsets are counted onwards from the
+ * previous word located, so that long lines are not scanned over and over.
+ */
+ListInterface::Position ListInterface::locate(
+	Glib::ustring const& line, Glib::ustring::const_iterator at)
+{
+	byte_ += parent_.user_length(col_pos_, at);
+	for (; col_pos_ != at; ++col_pos_) ++col_;
+
+	Position pos;
+	pos.line = lineno_;
+	pos.byte = byte_;
+	pos.chr = col_;
+	return pos;
+}
+
+/**
+ * Write a record of a misspelled word. The count is written only if it is
+ * nonzero.
+ */
+void ListInterface::write_json(Glib::ustring const& word,
+			       Position const& pos, unsigned long count)
+{
+	std::vector<Glib::ustring> suggestions;
+	parent_.get_suggestions(word, suggestions);
+
+	json_out_.begin("misspelling");
+	json_out_.field("file", "-");
+	json_out_.field("line", pos.line);
+	json_out_.field("byte", pos.byte);
+	json_out_.field("char", pos.chr);
+	json_out_.field("word", word);
+	if (count) json_out_.field("count", count);
+	json_out_.field("suggestions", suggestions);
+	json_out_.end();
+	json_out_.flush_if_full(std::cout);
+}
+
+void ListInterface::print_word(Glib::ustring const& word)
+{
+	if (utf8_)
+		std::cout.write(word.data(), word.bytes());
+	else
+		std::cout << parent_.to_user(word);
+}
+
+/**
+ * Count an occurrence of a word. The words are keyed by their bytes, as
+ * comparing them as Glib::ustrings would collate them.
+ */
+void ListInterface::add_word(Glib::ustring const& word,
+			     Position const& pos)
+{
+	std::pair<WordIndex::iterator, bool> p = index_.insert(
+		WordIndex::value_type(word.raw(), words_.size()));
+	if (p.second) {
+		words_.push_back(word);
+		counts_.push_back(1);
+		if (json_) positions_.push_back(pos);
+	} else {
+		++counts_[p.first->second];
+	}
+}
+
+/**
+ * Check each distinct word once, and list the misspelled ones in the order
+ * of their first appearance, with their counts if so wanted.
+ */
+void ListInterface::list_unique()
+{
+	std::vector<char> misspelled;
+	parent_.check_words(words_, misspelled);
 
-	delete filter;
+	bool counts = parent_.options().word_counts_;
+	for (size_t i = 0; i < words_.size(); ++i) {
+		if (!misspelled[i]) continue;
+		if (json_) {
+			write_json(words_[i], positions_[i], counts_[i]);
+			continue;
+		}
+		if (counts) std::cout << counts_[i] << ' ';
+		print_word(words_[i]);
+		std::cout << '\n';
+	}
+	std::cout.flush();
 }
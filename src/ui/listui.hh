@@ -24,18 +24,86 @@
 #ifndef LISTUI_HH_
 #define LISTUI_HH_
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "tmispell.hh"
+#include "json_writer.hh"
 
 /**
- * An interface that just lists misspelled words.
+ * An interface that just lists misspelled words. With --unique or --count,
+ * the words are gathered first, and each distinct word is checked once.
+ * With --json, the words are written as JSON Lines records instead.
  */
 class ListInterface
 {
 public:
-	ListInterface(IspellAlike& parent) : parent_(parent) {}
+	ListInterface(IspellAlike& parent)
+		: parent_(parent), filter_(0), utf8_(false), unique_(false),
+		  json_(false), lineno_(0), col_(0), byte_(0) {}
 	void start();
 private:
+	/// Check the words on a line and print the misspelled ones
+	void check_line(Glib::ustring const& line);
+
+	/// Print a word in the user's encoding
+	void print_word(Glib::ustring const& word);
+
+	/// The position of a word
+	struct Position
+	{
+		/// The line number, from 1
+		unsigned long line;
+		/// The offset in bytes of the input from the start of the line
+		unsigned long byte;
+		/// The offset in characters from the start of the line
+		unsigned long chr;
+	};
+
+	/// Find the position of a word starting at the given point of line
+	Position locate(Glib::ustring const& line,
+			Glib::ustring::const_iterator at);
+
+	/// Write a JSON record of a misspelled word
+	void write_json(Glib::ustring const& word, Position const& pos,
+			unsigned long count);
+
+	/// Count an occurrence of a word
+	void add_word(Glib::ustring const& word, Position const& pos);
+
+	/// Check the distinct words and list the misspelled ones
+	void list_unique();
+
+	/// Map from a word to its position in words_
+	typedef std::map<std::string, size_t> WordIndex;
+
 	IspellAlike& parent_;
+	Filter* filter_;
+	/// Is the output in UTF-8, so that it needs no conversion
+	bool utf8_;
+	/// Are the words gathered and checked once each
+	bool unique_;
+	/// Is the output in JSON Lines
+	bool json_;
+	/// The JSON output, not yet written
+	JsonWriter json_out_;
+	/// The number of the current line
+	unsigned long lineno_;
+	/// The last position located on the current line
+	Glib::ustring::const_iterator col_pos_;
+	/// The character offset of col_pos_
+	unsigned long col_;
+	/// The byte offset of col_pos_ in the input
+	unsigned long byte_;
+	/// The distinct words in the order of first appearance
+	std::vector<Glib::ustring> words_;
+	/// The number of occurrences of each word in words_
+	std::vector<unsigned long> counts_;
+	/// The first positions of the words in words_, with --json
+	std::vector<Position> positions_;
+	/// The positions of the words in words_
+	WordIndex index_;
 };
 
 #endif // LISTUI_HH_
@@ -28,6 +28,7 @@
 #include <algorithm>
 
 #include <ctype.h>
+#include <stdlib.h>
 #include <unistd.h>
 #include <signal.h>
 
@@ -58,17 +59,31 @@ void PipeInterface::start()
 #endif
 
 	std::ostream* out = parent_.open_output();
-	
-	*out << "@(#) International Ispell Version 3.1.20 compatible "
-	      << PACKAGE_STRING 
-	      << std::endl << std::flush;
+
+	json_ = parent_.options().json_;
+	lineno_ = 0;
+	if (json_) {
+		json_out_.begin("version");
+		json_out_.field("ispell", "3.1.20");
+		json_out_.field("version", PACKAGE_STRING);
+		json_out_.end();
+		json_out_.flush(*out);
+	} else {
+		*out << "@(#) International Ispell Version 3.1.20 compatible "
+		      << PACKAGE_STRING 
+		      << std::endl << std::flush;
+	}
 	terse_ = false;
 
+	// The engine has been initialized in the background meanwhile
+	parent_.wait_ready(true);
+
 	filter_ = parent_.create_default_filter();
 	include_depth_ = 0;
 
 	listen_pipe(std::cin);
 
+	forget_lines();
 	delete filter_;
 }
 
@@ -149,10 +164,12 @@ void PipeInterface::interpret_pipe_command(Glib::ustring str)
 		// Nothing to do.
 	} return;
 	case '+': // Enter TeX mode
+		forget_lines();
 		delete filter_;
 		filter_ = parent_.create_filter(Options::tex);
 		return;
 	case '-': // Exit TeX mode
+		forget_lines();
 		delete filter_;
 		filter_ = parent_.create_filter(Options::nroff);
 		return;
@@ -165,6 +182,14 @@ void PipeInterface::interpret_pipe_command(Glib::ustring str)
 	case '^': // Spell-check rest of line
 		spell_check_pipe(str, ++str.begin());
 		return;
+	case '=': // Check a line incrementally
+		if (str.raw().size() >= 2 && (str.raw()[1] == 'L' ||
+					      str.raw()[1] == 'E' ||
+					      str.raw()[1] == 'D')) {
+			interpret_line_command(str);
+			return;
+		}
+		break;
 	default: break;
 	}
 	
@@ -197,6 +222,11 @@ void PipeInterface::interpret_pipe_command(Glib::ustring str)
 void PipeInterface::spell_check_pipe(Glib::ustring const& str,
 				     Glib::ustring::const_iterator sbeg)
 {
+	if (json_) {
+		spell_check_json(str, sbeg);
+		return;
+	}
+
 	std::ostream* out = parent_.open_output();
 
 	// Spell check words
@@ -204,9 +234,9 @@ void PipeInterface::spell_check_pipe(Glib::ustring const& str,
 	filter_->reset(sbeg);
 
 	Glib::ustring::const_iterator begin, end;
-	while (filter_->get_next_word(&begin, &end))
+	while (filter_->next_word(&begin, &end))
 	{
-		Glib::ustring word(begin, end);
+		Glib::ustring word(filter_->word_text(begin, end));
 		
 		if (parent_.check_word(word))
 		{
@@ -214,40 +244,458 @@ void PipeInterface::spell_check_pipe(Glib::ustring const& str,
 		} 
 		else 
 		{
-			long offset = std::distance(str.begin(), begin);
-			
-			std::vector<Glib::ustring> suggestions; 
-			parent_.get_suggestions(word, suggestions);
-			
-			if (suggestions.empty()) {
-				*out << "# "
-				     << parent_.to_user(word)
-				     << " "
-				     << offset
-				     << std::endl;
-			} else {
-				*out << "& "
-				     << parent_.to_user(word)
-				     << " "
-				     << suggestions.size()
-				     << " "
-				     << offset
-				     << ": ";
-				
-				std::vector<Glib::ustring>::const_iterator i;
-				for (i = suggestions.begin();
-				     i != suggestions.end();
-				     ++i)
-				{
-					if (i != suggestions.begin())
-						*out << ", ";
-					*out << parent_.to_user(*i);
-				}
-				*out << std::endl;
-			}
+			print_misspelling(*out, word,
+					  std::distance(str.begin(), begin));
 		}
 	}
 
 	// Ispell prints also an empty line, in terse mode or not.
 	*out << std::endl;
 }
+
+/**
+ * Print the suggestions for a misspelled word as ispell does, or only the
+ * word if there are none.
+ */
+void PipeInterface::print_misspelling(std::ostream& out,
+				      Glib::ustring const& word, long offset)
+{
+	std::vector<Glib::ustring> suggestions; 
+	parent_.get_suggestions(word, suggestions);
+	
+	if (suggestions.empty()) {
+		out << "# "
+		    << parent_.to_user(word)
+		    << " "
+		    << offset
+		    << std::endl;
+	} else {
+		out << "& "
+		    << parent_.to_user(word)
+		    << " "
+		    << suggestions.size()
+		    << " "
+		    << offset
+		    << ": ";
+		
+		std::vector<Glib::ustring>::const_iterator i;
+		for (i = suggestions.begin();
+		     i != suggestions.end();
+		     ++i)
+		{
+			if (i != suggestions.begin())
+				out << ", ";
+			out << parent_.to_user(*i);
+		}
+		out << std::endl;
+	}
+}
+
+/**
+ * Spell check words in the given string, and print a record for each
+ * misspelled word,
+ *
+ *   {"type":"misspelling","file":"-","line":1,"byte":0,"char":0,
+ *    "word":"...","suggestions":[...]}
+ *
+ * followed by {"type":"end","line":1} in place of the empty line of the
+ * ispell format. The lines are counted from 1, and the offsets from the
+ * start of the text checked, without the command character, the byte
+ * offset in the encoding of the input. The records
+ * of a line are written at once.
+ */
+void PipeInterface::spell_check_json(Glib::ustring const& str,
+				     Glib::ustring::const_iterator sbeg)
+{
+	filter_->set_line(&str);
+	filter_->reset(sbeg);
+	++lineno_;
+
+	Glib::ustring::const_iterator col_pos = sbeg;
+	unsigned long col = 0;
+	unsigned long byte = 0;
+
+	Glib::ustring::const_iterator begin, end;
+	while (filter_->next_word(&begin, &end))
+	{
+		Glib::ustring word(filter_->word_text(begin, end));
+		if (parent_.check_word(word)) continue;
+
+		byte += parent_.user_length(col_pos, begin);
+		for (; col_pos != begin; ++col_pos) ++col;
+
+		std::vector<Glib::ustring> suggestions;
+		parent_.get_suggestions(word, suggestions);
+
+		json_out_.begin("misspelling");
+		json_out_.field("file", "-");
+		json_out_.field("line", lineno_);
+		json_out_.field("byte", byte);
+		json_out_.field("char", col);
+		json_out_.field("word", word);
+		json_out_.field("suggestions", suggestions);
+		json_out_.end();
+	}
+
+	json_out_.begin("end");
+	json_out_.field("line", lineno_);
+	json_out_.end();
+	json_out_.flush(*parent_.open_output());
+}
+
+/*
+ * Checking lines incrementally
+ */
+
+/** Save the state of the filter after every so many words of a line */
+static unsigned int const checkpoint_interval = 8;
+
+/** The ASCII whitespace, which ends every token of the filters */
+static char const* const whitespace = " \t\n\v\f\r";
+
+PipeInterface::CheckedLine::~CheckedLine()
+{
+	std::vector<LineCheckpoint>::iterator i;
+	for (i = checkpoints.begin(); i != checkpoints.end(); ++i)
+		delete i->state;
+	delete start;
+	delete end;
+}
+
+void PipeInterface::forget_lines()
+{
+	std::map<std::string, CheckedLine*>::iterator i;
+	for (i = lines_.begin(); i != lines_.end(); ++i) delete i->second;
+	lines_.clear();
+}
+
+/**
+ * Interpret the commands of incremental checking:
+ *
+ *   =L<id> <text>             Check the line text, and call it id.
+ *   =E<id> <start> <end> <text>
+ *                             Replace the characters from start to end
+ *                             of the line id with text, and check it.
+ *   =D<id>                    Forget the line id.
+ *
+ * The id is any string without spaces. A line is filtered in the state
+ * the filter is in after the line checked before, like an ordinary line.
+ */
+void PipeInterface::interpret_line_command(Glib::ustring const& str)
+{
+	std::string const& raw = str.raw();
+	std::string::size_type space = raw.find(' ', 2);
+	std::string id(raw, 2, space == std::string::npos
+		       ? std::string::npos : space - 2);
+	std::string rest;
+	if (space != std::string::npos) rest.assign(raw, space + 1,
+						    std::string::npos);
+
+	std::map<std::string, CheckedLine*>::iterator i = lines_.find(id);
+	CheckedLine* line = (i != lines_.end()) ? i->second : 0;
+
+	if (raw[1] == 'D' || raw[1] == 'L') {
+		delete line;
+		if (line) lines_.erase(i);
+		if (raw[1] == 'D') return;
+
+		line = new CheckedLine;
+		line->start = filter_->save_checkpoint();
+		lines_[id] = line;
+		recheck_line(id, line, 0, 0, rest);
+		return;
+	}
+
+	// =E: the offsets and the text after them
+	char const* p = rest.c_str();
+	char* after;
+	long begin = strtol(p, &after, 10);
+	bool valid = (after != p && *after == ' ');
+	p = after;
+	long end = strtol(p, &after, 10);
+	valid = valid && after != p;
+	if (*after == ' ') ++after;
+
+	if (!valid || begin < 0 || end < begin) line = 0;
+	recheck_line(id, line, begin, end, Glib::ustring(std::string(after)));
+}
+
+/**
+ * Find the byte offset of a character offset, counting from the closest
+ * word before it.
+ */
+std::string::size_type PipeInterface::byte_offset(CheckedLine const& line,
+						  long offset) const
+{
+	std::vector<CheckedWord> const& words = line.words;
+	std::vector<CheckedWord>::size_type lo = 0, hi = words.size();
+	while (lo < hi) {
+		std::vector<CheckedWord>::size_type mid = (lo + hi) / 2;
+		if (words[mid].offset <= offset) lo = mid + 1;
+		else hi = mid;
+	}
+
+	std::string const& raw = line.text.raw();
+	std::string::size_type byte = (lo > 0) ? words[lo - 1].begin : 0;
+	long n = (lo > 0) ? words[lo - 1].offset : 0;
+
+	Glib::ustring::const_iterator p(raw.begin() + byte);
+	for (; n < offset; ++n, ++p) {
+		if (p == line.text.end()) return std::string::npos;
+	}
+	return p.base() - raw.begin();
+}
+
+/**
+ * Find the byte offset of a word of the text in the user-specified
+ * encoding, in which the text was given. In UTF-8, it is the offset of the
+ * word as it is; otherwise the text before the word is converted.
+ */
+unsigned long PipeInterface::user_offset(Glib::ustring const& text,
+					 CheckedWord const& word)
+{
+	if (parent_.user_is_utf8()) return word.begin;
+	return parent_.user_length(text.begin(), Glib::ustring::const_iterator(
+					   text.raw().begin() + word.begin));
+}
+
+/**
+ * Replace the characters [begin, end) of the line with text, and check
+ * the line again. Filtering goes on from the last checkpoint before the
+ * token of the edit, and stops at the first checkpoint after it where
+ * the state of the filter is the same as on the last check. The words
+ * after that are as they were, only moved.
+ *
+ * The response has the misspellings gone, with their offsets in the line
+ * before the edit, and the new ones, with their offsets in the line after
+ * it:
+ *
+ *   - <word> <offset>
+ *   & <word> <count> <offset>: <suggestions>
+ *   # <word> <offset>
+ *
+ * and an empty line. With --json, the records are "correct" and
+ * "misspelling", and an "end" record. An unknown line or bad offsets give
+ * an empty response.
+ */
+void PipeInterface::recheck_line(std::string const& id, CheckedLine* line,
+				 long begin, long end,
+				 Glib::ustring const& text)
+{
+	std::string::size_type edit_begin = std::string::npos;
+	std::string::size_type edit_end = std::string::npos;
+	if (line) {
+		edit_begin = byte_offset(*line, begin);
+		edit_end = byte_offset(*line, end);
+	}
+
+	std::vector<CheckedWord> gone, added;
+
+	// The byte offsets of the words gone are reported in the line before
+	// the edit, so keep it, if it is not in UTF-8 like the input
+	Glib::ustring old_text;
+	if (json_ && line && !parent_.user_is_utf8()) old_text = line->text;
+
+	if (edit_begin != std::string::npos && edit_end != std::string::npos) {
+		std::vector<CheckedWord>& words = line->words;
+		std::vector<LineCheckpoint>& checkpoints = line->checkpoints;
+
+		// The last checkpoint with whitespace after it before the edit
+		std::string const& old_raw = line->text.raw();
+		std::string::size_type space = (edit_begin > 0)
+			? old_raw.find_last_of(whitespace, edit_begin - 1)
+			: std::string::npos;
+		std::vector<LineCheckpoint>::size_type kept = checkpoints.size();
+		while (kept > 0 && (space == std::string::npos ||
+				    checkpoints[kept - 1].end > space))
+			--kept;
+		std::string::size_type from = 0;
+		long from_offset = 0;
+		if (kept > 0) {
+			from = checkpoints[kept - 1].end;
+			from_offset = checkpoints[kept - 1].offset;
+		}
+		std::vector<CheckedWord>::size_type first = 0;
+		while (first < words.size() && words[first].begin < from)
+			++first;
+
+		// Edit the line
+		long shift = (long)text.bytes() - (long)(edit_end - edit_begin);
+		long shift_chars = (long)text.length() - (end - begin);
+		std::string raw(old_raw, 0, edit_begin);
+		raw += text.raw();
+		raw.append(old_raw, edit_end, std::string::npos);
+		line->text = raw;
+		std::string::const_iterator raw_begin = line->text.raw().begin();
+
+		// The filter may come back to the old state after a token
+		// following the edit
+		std::string::size_type resync = line->text.raw().find_first_of(
+			whitespace, edit_begin + text.bytes());
+
+		if (kept > 0) {
+			filter_->set_line(&line->text);
+			filter_->reset(Glib::ustring::const_iterator(
+					       raw_begin + from));
+			filter_->restore_checkpoint(
+				*checkpoints[kept - 1].state);
+		} else {
+			if (line->start)
+				filter_->restore_checkpoint(*line->start);
+			filter_->set_line(&line->text);
+		}
+
+		std::vector<CheckedWord> found;
+		std::vector<LineCheckpoint> saved;
+		std::vector<LineCheckpoint>::size_type sync = kept;
+		bool synced = false;
+
+		Glib::ustring::const_iterator col_pos(raw_begin + from);
+		long col = from_offset;
+		Glib::ustring::const_iterator word_begin, word_end;
+		while (filter_->next_word(&word_begin, &word_end)) {
+			CheckedWord word;
+			word.begin = word_begin.base() - raw_begin;
+			word.end = word_end.base() - raw_begin;
+			for (; col_pos != word_begin; ++col_pos) ++col;
+			word.offset = col;
+			word.word = filter_->word_text(word_begin, word_end);
+			word.misspelled = !parent_.check_word(word.word);
+			found.push_back(word);
+			for (; col_pos != word_end; ++col_pos) ++col;
+
+			// Is the state the same as after this word before?
+			while (sync < checkpoints.size() &&
+			       (long)checkpoints[sync].end + shift <
+			       (long)word.end)
+				++sync;
+			if (sync < checkpoints.size() &&
+			    checkpoints[sync].end >= edit_end &&
+			    (long)checkpoints[sync].end + shift ==
+			    (long)word.end &&
+			    resync != std::string::npos && word.end > resync) {
+				Filter::Checkpoint* state =
+					filter_->save_checkpoint();
+				synced = state &&
+					state->same_as(*checkpoints[sync].state);
+				delete state;
+				if (synced) break;
+			}
+
+			if (found.size() % checkpoint_interval == 0) {
+				LineCheckpoint checkpoint;
+				checkpoint.end = word.end;
+				checkpoint.offset = col;
+				checkpoint.state = filter_->save_checkpoint();
+				if (checkpoint.state) saved.push_back(checkpoint);
+			}
+		}
+
+		// The old words and checkpoints replaced
+		std::vector<CheckedWord>::size_type last = words.size();
+		if (synced) {
+			last = first;
+			while (last < words.size() &&
+			       words[last].begin < checkpoints[sync].end)
+				++last;
+		} else {
+			sync = checkpoints.size();
+		}
+
+		// Compare the misspellings of the old and the new words
+		std::vector<char> unchanged(found.size(), 0);
+		std::vector<CheckedWord>::size_type i, j;
+		for (i = first; i < last; ++i) {
+			CheckedWord const& old = words[i];
+			if (!old.misspelled) continue;
+
+			long moved = 0;
+			bool kept_place = true;
+			if (old.begin >= edit_end) moved = shift;
+			else if (old.end > edit_begin) kept_place = false;
+
+			for (j = 0; kept_place && j < found.size(); ++j) {
+				if (found[j].misspelled &&
+				    (long)found[j].begin ==
+				    (long)old.begin + moved &&
+				    (long)found[j].end == (long)old.end + moved &&
+				    found[j].word == old.word) {
+					unchanged[j] = 1;
+					break;
+				}
+			}
+			if (!kept_place || j == found.size()) gone.push_back(old);
+		}
+		for (j = 0; j < found.size(); ++j) {
+			if (found[j].misspelled && !unchanged[j])
+				added.push_back(found[j]);
+		}
+
+		// Move the words after the ones found, and replace the rest
+		for (i = last; i < words.size(); ++i) {
+			words[i].begin += shift;
+			words[i].end += shift;
+			words[i].offset += shift_chars;
+		}
+		words.erase(words.begin() + first, words.begin() + last);
+		words.insert(words.begin() + first, found.begin(), found.end());
+
+		for (i = kept; i < sync; ++i) delete checkpoints[i].state;
+		for (i = sync; i < checkpoints.size(); ++i) {
+			checkpoints[i].end += shift;
+			checkpoints[i].offset += shift_chars;
+		}
+		checkpoints.erase(checkpoints.begin() + kept,
+				  checkpoints.begin() + sync);
+		checkpoints.insert(checkpoints.begin() + kept,
+				   saved.begin(), saved.end());
+
+		// Leave the filter at the end of the line
+		if (synced) {
+			filter_->set_line(&line->text);
+			filter_->reset(line->text.end());
+			if (line->end) filter_->restore_checkpoint(*line->end);
+		} else {
+			delete line->end;
+			line->end = filter_->save_checkpoint();
+		}
+	}
+
+	// Report the misspellings gone and the new ones
+	std::vector<CheckedWord>::const_iterator w;
+	if (json_) {
+		for (w = gone.begin(); w != gone.end(); ++w) {
+			json_out_.begin("correct");
+			json_out_.field("id", id);
+			json_out_.field("byte", user_offset(old_text, *w));
+			json_out_.field("char", (unsigned long)w->offset);
+			json_out_.field("word", w->word);
+			json_out_.end();
+		}
+		for (w = added.begin(); w != added.end(); ++w) {
+			std::vector<Glib::ustring> suggestions;
+			parent_.get_suggestions(w->word, suggestions);
+
+			json_out_.begin("misspelling");
+			json_out_.field("id", id);
+			json_out_.field("byte", user_offset(line->text, *w));
+			json_out_.field("char", (unsigned long)w->offset);
+			json_out_.field("word", w->word);
+			json_out_.field("suggestions", suggestions);
+			json_out_.end();
+		}
+		json_out_.begin("end");
+		json_out_.field("id", id);
+		json_out_.end();
+		json_out_.flush(*parent_.open_output());
+	} else {
+		std::ostream* out = parent_.open_output();
+		for (w = gone.begin(); w != gone.end(); ++w) {
+			*out << "- " << parent_.to_user(w->word) << " "
+			     << w->offset << std::endl;
+		}
+		for (w = added.begin(); w != added.end(); ++w)
+			print_misspelling(*out, w->word, w->offset);
+		*out << std::endl;
+	}
+}
@@ -24,18 +24,30 @@
 #ifndef PIPEUI_HH_
 #define PIPEUI_HH_
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include "tmispell.hh"
+#include "filter.hh"
+#include "json_writer.hh"
 #include "glibmm/ustring.h"
 
 /**
  * An interface that reads commands from stdin and acts according
- * to them.
+ * to them. With --json, the responses to the lines checked are JSON Lines
+ * records instead of the ispell format.
+ *
+ * Lines given an identifier with =L can be edited with =E. Then only the
+ * part of the line around the edit is filtered and checked again, and
+ * only the misspellings that appear or go away are reported.
  */
 class PipeInterface
 {
 public:
 	PipeInterface(IspellAlike& parent) : parent_(parent),
-		filter_(0), include_depth_(0), terse_(false) {}
+		filter_(0), include_depth_(0), terse_(false), json_(false),
+		lineno_(0) {}
 	
 	void start();
 	
@@ -54,6 +66,86 @@ private:
 			      Glib::ustring::const_iterator str_begin);
 	void spell_check_pipe(Glib::ustring const& str)
 		{ spell_check_pipe(str, str.begin()); }
+
+	/** Spell check words and output the response as JSON */
+	void spell_check_json(Glib::ustring const& str,
+			      Glib::ustring::const_iterator str_begin);
+
+	/** Print the ispell response for a misspelled word */
+	void print_misspelling(std::ostream& out, Glib::ustring const& word,
+			       long offset);
+
+	/** Interpret a =L, =E or =D command */
+	void interpret_line_command(Glib::ustring const& str);
+
+	/** Forget the lines checked incrementally */
+	void forget_lines();
+
+private:
+	/** A word found on a line checked incrementally */
+	struct CheckedWord
+	{
+		/// The byte offsets of the word in the line
+		std::string::size_type begin, end;
+
+		/// The character offset of the word in the line
+		long offset;
+
+		/// The word, as spell checked
+		Glib::ustring word;
+
+		/// Is the word misspelled
+		bool misspelled;
+	};
+
+	/** The state of the filter after a word of a line */
+	struct LineCheckpoint
+	{
+		/// The byte offset of the end of the word
+		std::string::size_type end;
+
+		/// The character offset of the end of the word
+		long offset;
+
+		/// The state of the filter
+		Filter::Checkpoint* state;
+	};
+
+	/** A line checked incrementally, and the words found on it */
+	struct CheckedLine
+	{
+		CheckedLine() : start(0), end(0) {}
+		~CheckedLine();
+
+		/// The text of the line
+		Glib::ustring text;
+
+		/// The words found, in order
+		std::vector<CheckedWord> words;
+
+		/// The states of the filter after some of the words, in order
+		std::vector<LineCheckpoint> checkpoints;
+
+		/// The states of the filter before and after the line
+		Filter::Checkpoint* start;
+		Filter::Checkpoint* end;
+
+	private:
+		CheckedLine(CheckedLine const&);
+		CheckedLine& operator=(CheckedLine const&);
+	};
+
+	/** The byte offset of a character offset in the line, or npos */
+	std::string::size_type byte_offset(CheckedLine const& line,
+					   long offset) const;
+
+	/** The byte offset of a word of the text in the user's encoding */
+	unsigned long user_offset(Glib::ustring const& text,
+				  CheckedWord const& word);
+
+	/** Replace [begin, end) of the line and check it again */
+	void recheck_line(std::string const& id, CheckedLine* line,
+			  long begin, long end, Glib::ustring const& text);
 	
 private:
 	IspellAlike& parent_;
@@ -66,6 +158,18 @@ private:
 	
 	/** Is this interface in terse output mode */
 	bool terse_;
+
+	/** Is the output in JSON Lines */
+	bool json_;
+
+	/** The JSON output of the line being checked */
+	JsonWriter json_out_;
+
+	/** The number of lines checked */
+	unsigned long lineno_;
+
+	/** The lines checked incrementally, by their identifiers */
+	std::map<std::string, CheckedLine*> lines_;
 };
 
 #endif // PIPEUI_HH_